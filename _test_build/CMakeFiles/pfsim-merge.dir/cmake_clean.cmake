@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pfsim-merge.dir/src/pfsimMerge.cpp.o"
+  "CMakeFiles/pfsim-merge.dir/src/pfsimMerge.cpp.o.d"
+  "pfsim-merge"
+  "pfsim-merge.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pfsim-merge.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pfsim.dir/src/clparser.cpp.o"
+  "CMakeFiles/pfsim.dir/src/clparser.cpp.o.d"
+  "CMakeFiles/pfsim.dir/src/main.cpp.o"
+  "CMakeFiles/pfsim.dir/src/main.cpp.o.d"
+  "pfsim"
+  "pfsim.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pfsim.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
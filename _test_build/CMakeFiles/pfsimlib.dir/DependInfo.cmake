@@ -0,0 +1,41 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/aliasTable.cpp" "CMakeFiles/pfsimlib.dir/src/aliasTable.cpp.o" "gcc" "CMakeFiles/pfsimlib.dir/src/aliasTable.cpp.o.d"
+  "/root/repo/src/asset.cpp" "CMakeFiles/pfsimlib.dir/src/asset.cpp.o" "gcc" "CMakeFiles/pfsimlib.dir/src/asset.cpp.o.d"
+  "/root/repo/src/householdBook.cpp" "CMakeFiles/pfsimlib.dir/src/householdBook.cpp.o" "gcc" "CMakeFiles/pfsimlib.dir/src/householdBook.cpp.o.d"
+  "/root/repo/src/mappedFile.cpp" "CMakeFiles/pfsimlib.dir/src/mappedFile.cpp.o" "gcc" "CMakeFiles/pfsimlib.dir/src/mappedFile.cpp.o.d"
+  "/root/repo/src/modelCorrelated.cpp" "CMakeFiles/pfsimlib.dir/src/modelCorrelated.cpp.o" "gcc" "CMakeFiles/pfsimlib.dir/src/modelCorrelated.cpp.o.d"
+  "/root/repo/src/modelHistorical.cpp" "CMakeFiles/pfsimlib.dir/src/modelHistorical.cpp.o" "gcc" "CMakeFiles/pfsimlib.dir/src/modelHistorical.cpp.o.d"
+  "/root/repo/src/modelInflation.cpp" "CMakeFiles/pfsimlib.dir/src/modelInflation.cpp.o" "gcc" "CMakeFiles/pfsimlib.dir/src/modelInflation.cpp.o.d"
+  "/root/repo/src/modelMortality.cpp" "CMakeFiles/pfsimlib.dir/src/modelMortality.cpp.o" "gcc" "CMakeFiles/pfsimlib.dir/src/modelMortality.cpp.o.d"
+  "/root/repo/src/modelRecession.cpp" "CMakeFiles/pfsimlib.dir/src/modelRecession.cpp.o" "gcc" "CMakeFiles/pfsimlib.dir/src/modelRecession.cpp.o.d"
+  "/root/repo/src/modelRegime.cpp" "CMakeFiles/pfsimlib.dir/src/modelRegime.cpp.o" "gcc" "CMakeFiles/pfsimlib.dir/src/modelRegime.cpp.o.d"
+  "/root/repo/src/monthlyEngine.cpp" "CMakeFiles/pfsimlib.dir/src/monthlyEngine.cpp.o" "gcc" "CMakeFiles/pfsimlib.dir/src/monthlyEngine.cpp.o.d"
+  "/root/repo/src/ndjsonStream.cpp" "CMakeFiles/pfsimlib.dir/src/ndjsonStream.cpp.o" "gcc" "CMakeFiles/pfsimlib.dir/src/ndjsonStream.cpp.o.d"
+  "/root/repo/src/personalFinSim.cpp" "CMakeFiles/pfsimlib.dir/src/personalFinSim.cpp.o" "gcc" "CMakeFiles/pfsimlib.dir/src/personalFinSim.cpp.o.d"
+  "/root/repo/src/profileBinary.cpp" "CMakeFiles/pfsimlib.dir/src/profileBinary.cpp.o" "gcc" "CMakeFiles/pfsimlib.dir/src/profileBinary.cpp.o.d"
+  "/root/repo/src/profileSchedule.cpp" "CMakeFiles/pfsimlib.dir/src/profileSchedule.cpp.o" "gcc" "CMakeFiles/pfsimlib.dir/src/profileSchedule.cpp.o.d"
+  "/root/repo/src/resultCache.cpp" "CMakeFiles/pfsimlib.dir/src/resultCache.cpp.o" "gcc" "CMakeFiles/pfsimlib.dir/src/resultCache.cpp.o.d"
+  "/root/repo/src/rmdTable.cpp" "CMakeFiles/pfsimlib.dir/src/rmdTable.cpp.o" "gcc" "CMakeFiles/pfsimlib.dir/src/rmdTable.cpp.o.d"
+  "/root/repo/src/scenarioBank.cpp" "CMakeFiles/pfsimlib.dir/src/scenarioBank.cpp.o" "gcc" "CMakeFiles/pfsimlib.dir/src/scenarioBank.cpp.o.d"
+  "/root/repo/src/simServer.cpp" "CMakeFiles/pfsimlib.dir/src/simServer.cpp.o" "gcc" "CMakeFiles/pfsimlib.dir/src/simServer.cpp.o.d"
+  "/root/repo/src/studyRun.cpp" "CMakeFiles/pfsimlib.dir/src/studyRun.cpp.o" "gcc" "CMakeFiles/pfsimlib.dir/src/studyRun.cpp.o.d"
+  "/root/repo/src/taxModel.cpp" "CMakeFiles/pfsimlib.dir/src/taxModel.cpp.o" "gcc" "CMakeFiles/pfsimlib.dir/src/taxModel.cpp.o.d"
+  "/root/repo/src/threadPool.cpp" "CMakeFiles/pfsimlib.dir/src/threadPool.cpp.o" "gcc" "CMakeFiles/pfsimlib.dir/src/threadPool.cpp.o.d"
+  "/root/repo/src/userDataLoading.cpp" "CMakeFiles/pfsimlib.dir/src/userDataLoading.cpp.o" "gcc" "CMakeFiles/pfsimlib.dir/src/userDataLoading.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,55 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pfsimlib.dir/src/aliasTable.cpp.o"
+  "CMakeFiles/pfsimlib.dir/src/aliasTable.cpp.o.d"
+  "CMakeFiles/pfsimlib.dir/src/asset.cpp.o"
+  "CMakeFiles/pfsimlib.dir/src/asset.cpp.o.d"
+  "CMakeFiles/pfsimlib.dir/src/householdBook.cpp.o"
+  "CMakeFiles/pfsimlib.dir/src/householdBook.cpp.o.d"
+  "CMakeFiles/pfsimlib.dir/src/mappedFile.cpp.o"
+  "CMakeFiles/pfsimlib.dir/src/mappedFile.cpp.o.d"
+  "CMakeFiles/pfsimlib.dir/src/modelCorrelated.cpp.o"
+  "CMakeFiles/pfsimlib.dir/src/modelCorrelated.cpp.o.d"
+  "CMakeFiles/pfsimlib.dir/src/modelHistorical.cpp.o"
+  "CMakeFiles/pfsimlib.dir/src/modelHistorical.cpp.o.d"
+  "CMakeFiles/pfsimlib.dir/src/modelInflation.cpp.o"
+  "CMakeFiles/pfsimlib.dir/src/modelInflation.cpp.o.d"
+  "CMakeFiles/pfsimlib.dir/src/modelMortality.cpp.o"
+  "CMakeFiles/pfsimlib.dir/src/modelMortality.cpp.o.d"
+  "CMakeFiles/pfsimlib.dir/src/modelRecession.cpp.o"
+  "CMakeFiles/pfsimlib.dir/src/modelRecession.cpp.o.d"
+  "CMakeFiles/pfsimlib.dir/src/modelRegime.cpp.o"
+  "CMakeFiles/pfsimlib.dir/src/modelRegime.cpp.o.d"
+  "CMakeFiles/pfsimlib.dir/src/monthlyEngine.cpp.o"
+  "CMakeFiles/pfsimlib.dir/src/monthlyEngine.cpp.o.d"
+  "CMakeFiles/pfsimlib.dir/src/ndjsonStream.cpp.o"
+  "CMakeFiles/pfsimlib.dir/src/ndjsonStream.cpp.o.d"
+  "CMakeFiles/pfsimlib.dir/src/personalFinSim.cpp.o"
+  "CMakeFiles/pfsimlib.dir/src/personalFinSim.cpp.o.d"
+  "CMakeFiles/pfsimlib.dir/src/profileBinary.cpp.o"
+  "CMakeFiles/pfsimlib.dir/src/profileBinary.cpp.o.d"
+  "CMakeFiles/pfsimlib.dir/src/profileSchedule.cpp.o"
+  "CMakeFiles/pfsimlib.dir/src/profileSchedule.cpp.o.d"
+  "CMakeFiles/pfsimlib.dir/src/resultCache.cpp.o"
+  "CMakeFiles/pfsimlib.dir/src/resultCache.cpp.o.d"
+  "CMakeFiles/pfsimlib.dir/src/rmdTable.cpp.o"
+  "CMakeFiles/pfsimlib.dir/src/rmdTable.cpp.o.d"
+  "CMakeFiles/pfsimlib.dir/src/scenarioBank.cpp.o"
+  "CMakeFiles/pfsimlib.dir/src/scenarioBank.cpp.o.d"
+  "CMakeFiles/pfsimlib.dir/src/simServer.cpp.o"
+  "CMakeFiles/pfsimlib.dir/src/simServer.cpp.o.d"
+  "CMakeFiles/pfsimlib.dir/src/studyRun.cpp.o"
+  "CMakeFiles/pfsimlib.dir/src/studyRun.cpp.o.d"
+  "CMakeFiles/pfsimlib.dir/src/taxModel.cpp.o"
+  "CMakeFiles/pfsimlib.dir/src/taxModel.cpp.o.d"
+  "CMakeFiles/pfsimlib.dir/src/threadPool.cpp.o"
+  "CMakeFiles/pfsimlib.dir/src/threadPool.cpp.o.d"
+  "CMakeFiles/pfsimlib.dir/src/userDataLoading.cpp.o"
+  "CMakeFiles/pfsimlib.dir/src/userDataLoading.cpp.o.d"
+  "libpfsimlib.a"
+  "libpfsimlib.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pfsimlib.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,39 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/test_asset.cpp" "tests/CMakeFiles/tests.dir/test_asset.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_asset.cpp.o.d"
+  "/root/repo/tests/test_dataloading.cpp" "tests/CMakeFiles/tests.dir/test_dataloading.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_dataloading.cpp.o.d"
+  "/root/repo/tests/test_householdBook.cpp" "tests/CMakeFiles/tests.dir/test_householdBook.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_householdBook.cpp.o.d"
+  "/root/repo/tests/test_modelCorrelated.cpp" "tests/CMakeFiles/tests.dir/test_modelCorrelated.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_modelCorrelated.cpp.o.d"
+  "/root/repo/tests/test_modelHistorical.cpp" "tests/CMakeFiles/tests.dir/test_modelHistorical.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_modelHistorical.cpp.o.d"
+  "/root/repo/tests/test_modelInflation.cpp" "tests/CMakeFiles/tests.dir/test_modelInflation.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_modelInflation.cpp.o.d"
+  "/root/repo/tests/test_modelMortality.cpp" "tests/CMakeFiles/tests.dir/test_modelMortality.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_modelMortality.cpp.o.d"
+  "/root/repo/tests/test_modelRegime.cpp" "tests/CMakeFiles/tests.dir/test_modelRegime.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_modelRegime.cpp.o.d"
+  "/root/repo/tests/test_monthlyEngine.cpp" "tests/CMakeFiles/tests.dir/test_monthlyEngine.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_monthlyEngine.cpp.o.d"
+  "/root/repo/tests/test_ndjsonStream.cpp" "tests/CMakeFiles/tests.dir/test_ndjsonStream.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_ndjsonStream.cpp.o.d"
+  "/root/repo/tests/test_profileBinary.cpp" "tests/CMakeFiles/tests.dir/test_profileBinary.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_profileBinary.cpp.o.d"
+  "/root/repo/tests/test_profileSchedule.cpp" "tests/CMakeFiles/tests.dir/test_profileSchedule.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_profileSchedule.cpp.o.d"
+  "/root/repo/tests/test_resultCache.cpp" "tests/CMakeFiles/tests.dir/test_resultCache.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_resultCache.cpp.o.d"
+  "/root/repo/tests/test_rmdTable.cpp" "tests/CMakeFiles/tests.dir/test_rmdTable.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_rmdTable.cpp.o.d"
+  "/root/repo/tests/test_simServer.cpp" "tests/CMakeFiles/tests.dir/test_simServer.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_simServer.cpp.o.d"
+  "/root/repo/tests/test_simulation.cpp" "tests/CMakeFiles/tests.dir/test_simulation.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_simulation.cpp.o.d"
+  "/root/repo/tests/test_studyRun.cpp" "tests/CMakeFiles/tests.dir/test_studyRun.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_studyRun.cpp.o.d"
+  "/root/repo/tests/test_taxModel.cpp" "tests/CMakeFiles/tests.dir/test_taxModel.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/test_taxModel.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/_deps/googletest-build/googletest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "/root/repo/_test_build/CMakeFiles/pfsimlib.dir/DependInfo.cmake"
+  "/root/repo/_test_build/_deps/googletest-build/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,46 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests.dir/test_asset.cpp.o"
+  "CMakeFiles/tests.dir/test_asset.cpp.o.d"
+  "CMakeFiles/tests.dir/test_dataloading.cpp.o"
+  "CMakeFiles/tests.dir/test_dataloading.cpp.o.d"
+  "CMakeFiles/tests.dir/test_householdBook.cpp.o"
+  "CMakeFiles/tests.dir/test_householdBook.cpp.o.d"
+  "CMakeFiles/tests.dir/test_modelCorrelated.cpp.o"
+  "CMakeFiles/tests.dir/test_modelCorrelated.cpp.o.d"
+  "CMakeFiles/tests.dir/test_modelHistorical.cpp.o"
+  "CMakeFiles/tests.dir/test_modelHistorical.cpp.o.d"
+  "CMakeFiles/tests.dir/test_modelInflation.cpp.o"
+  "CMakeFiles/tests.dir/test_modelInflation.cpp.o.d"
+  "CMakeFiles/tests.dir/test_modelMortality.cpp.o"
+  "CMakeFiles/tests.dir/test_modelMortality.cpp.o.d"
+  "CMakeFiles/tests.dir/test_modelRegime.cpp.o"
+  "CMakeFiles/tests.dir/test_modelRegime.cpp.o.d"
+  "CMakeFiles/tests.dir/test_monthlyEngine.cpp.o"
+  "CMakeFiles/tests.dir/test_monthlyEngine.cpp.o.d"
+  "CMakeFiles/tests.dir/test_ndjsonStream.cpp.o"
+  "CMakeFiles/tests.dir/test_ndjsonStream.cpp.o.d"
+  "CMakeFiles/tests.dir/test_profileBinary.cpp.o"
+  "CMakeFiles/tests.dir/test_profileBinary.cpp.o.d"
+  "CMakeFiles/tests.dir/test_profileSchedule.cpp.o"
+  "CMakeFiles/tests.dir/test_profileSchedule.cpp.o.d"
+  "CMakeFiles/tests.dir/test_resultCache.cpp.o"
+  "CMakeFiles/tests.dir/test_resultCache.cpp.o.d"
+  "CMakeFiles/tests.dir/test_rmdTable.cpp.o"
+  "CMakeFiles/tests.dir/test_rmdTable.cpp.o.d"
+  "CMakeFiles/tests.dir/test_simServer.cpp.o"
+  "CMakeFiles/tests.dir/test_simServer.cpp.o.d"
+  "CMakeFiles/tests.dir/test_simulation.cpp.o"
+  "CMakeFiles/tests.dir/test_simulation.cpp.o.d"
+  "CMakeFiles/tests.dir/test_studyRun.cpp.o"
+  "CMakeFiles/tests.dir/test_studyRun.cpp.o.d"
+  "CMakeFiles/tests.dir/test_taxModel.cpp.o"
+  "CMakeFiles/tests.dir/test_taxModel.cpp.o.d"
+  "tests"
+  "tests.pdb"
+  "tests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,165 @@
+add_test([=[AssetTest.StandardConstructor]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=AssetTest.StandardConstructor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AssetTest.StandardConstructor]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AssetTest.AddCashReserveSuccess]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=AssetTest.AddCashReserveSuccess]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AssetTest.AddCashReserveSuccess]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AssetTest.AddCashReserveFail]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=AssetTest.AddCashReserveFail]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AssetTest.AddCashReserveFail]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AssetTest.ClearCashReserve]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=AssetTest.ClearCashReserve]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AssetTest.ClearCashReserve]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AssetTest.ConstantNoGrowthModel]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=AssetTest.ConstantNoGrowthModel]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AssetTest.ConstantNoGrowthModel]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AssetTest.OneYearIncomeNoGrowthModel]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=AssetTest.OneYearIncomeNoGrowthModel]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AssetTest.OneYearIncomeNoGrowthModel]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AssetTest.MultipleYearIncomeNoGrowthModel]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=AssetTest.MultipleYearIncomeNoGrowthModel]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AssetTest.MultipleYearIncomeNoGrowthModel]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AssetTest.SimpleInflationNoGrowthModel]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=AssetTest.SimpleInflationNoGrowthModel]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AssetTest.SimpleInflationNoGrowthModel]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AssetTest.SimpleGrowthNoInflationModel]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=AssetTest.SimpleGrowthNoInflationModel]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AssetTest.SimpleGrowthNoInflationModel]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AssetTest.SimpleGrowthNoInflationModelMaxRange]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=AssetTest.SimpleGrowthNoInflationModelMaxRange]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AssetTest.SimpleGrowthNoInflationModelMaxRange]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AssetTest.MaxLongevityNoGrowthModel]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=AssetTest.MaxLongevityNoGrowthModel]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AssetTest.MaxLongevityNoGrowthModel]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AssetTest.SimpleIncomeSimplePensionNoInflationNoGrowthMaxModel]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=AssetTest.SimpleIncomeSimplePensionNoInflationNoGrowthMaxModel]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AssetTest.SimpleIncomeSimplePensionNoInflationNoGrowthMaxModel]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AssetTest.SimpleIncomeSimplePensionNoInflationNoGrowthGapModel]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=AssetTest.SimpleIncomeSimplePensionNoInflationNoGrowthGapModel]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AssetTest.SimpleIncomeSimplePensionNoInflationNoGrowthGapModel]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AssetTest.CashReserveDrawnAfterLossRefilledAfterGain]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=AssetTest.CashReserveDrawnAfterLossRefilledAfterGain]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AssetTest.CashReserveDrawnAfterLossRefilledAfterGain]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AssetTest.CashReserveCoversShortfallWithoutGrowth]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=AssetTest.CashReserveCoversShortfallWithoutGrowth]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AssetTest.CashReserveCoversShortfallWithoutGrowth]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AssetTest.SpendingRulesFollowThePortfolio]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=AssetTest.SpendingRulesFollowThePortfolio]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AssetTest.SpendingRulesFollowThePortfolio]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UserDataLoadingTest.OutOfRangeLargeValue]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=UserDataLoadingTest.OutOfRangeLargeValue]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UserDataLoadingTest.OutOfRangeLargeValue]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UserDataLoadingTest.MissingDataField]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=UserDataLoadingTest.MissingDataField]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UserDataLoadingTest.MissingDataField]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UserDataLoadingTest.UnknownKeyInGeneralSection]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=UserDataLoadingTest.UnknownKeyInGeneralSection]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UserDataLoadingTest.UnknownKeyInGeneralSection]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UserDataLoadingTest.CannotParseKeyValueInGeneralSection]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=UserDataLoadingTest.CannotParseKeyValueInGeneralSection]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UserDataLoadingTest.CannotParseKeyValueInGeneralSection]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UserDataLoadingTest.LeadingPlusSignIsAccepted]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=UserDataLoadingTest.LeadingPlusSignIsAccepted]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UserDataLoadingTest.LeadingPlusSignIsAccepted]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UserDataLoadingTest.BoundsCheckSuccess]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=UserDataLoadingTest.BoundsCheckSuccess]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UserDataLoadingTest.BoundsCheckSuccess]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UserDataLoadingTest.BoundsCheckNegativeValue]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=UserDataLoadingTest.BoundsCheckNegativeValue]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UserDataLoadingTest.BoundsCheckNegativeValue]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UserDataLoadingTest.BoundsCheckLargeValue]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=UserDataLoadingTest.BoundsCheckLargeValue]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UserDataLoadingTest.BoundsCheckLargeValue]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UserDataLoadingTest.ErrorReportsLineAndColumn]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=UserDataLoadingTest.ErrorReportsLineAndColumn]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UserDataLoadingTest.ErrorReportsLineAndColumn]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[UserDataLoadingTest.EventsCompileIntoYearlyExpense]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=UserDataLoadingTest.EventsCompileIntoYearlyExpense]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[UserDataLoadingTest.EventsCompileIntoYearlyExpense]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HouseholdBookTest.LoadCsvBook]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=HouseholdBookTest.LoadCsvBook]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HouseholdBookTest.LoadCsvBook]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HouseholdBookTest.LargeTsvBookKeepsOrderAndSkipsInvalid]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=HouseholdBookTest.LargeTsvBookKeepsOrderAndSkipsInvalid]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HouseholdBookTest.LargeTsvBookKeepsOrderAndSkipsInvalid]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HouseholdBookTest.MalformedRow]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=HouseholdBookTest.MalformedRow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HouseholdBookTest.MalformedRow]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HouseholdBookTest.UnknownColumn]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=HouseholdBookTest.UnknownColumn]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HouseholdBookTest.UnknownColumn]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CorrelatedModelTest.FactorReproducesTheCovariance]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=CorrelatedModelTest.FactorReproducesTheCovariance]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CorrelatedModelTest.FactorReproducesTheCovariance]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CorrelatedModelTest.DefaultCovarianceFollowsTheStockRatio]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=CorrelatedModelTest.DefaultCovarianceFollowsTheStockRatio]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CorrelatedModelTest.DefaultCovarianceFollowsTheStockRatio]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CorrelatedModelTest.RejectsInvalidMatrices]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=CorrelatedModelTest.RejectsInvalidMatrices]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CorrelatedModelTest.RejectsInvalidMatrices]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CorrelatedModelTest.ReturnsHaveTheProfileMeanAndCovariance]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=CorrelatedModelTest.ReturnsHaveTheProfileMeanAndCovariance]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CorrelatedModelTest.ReturnsHaveTheProfileMeanAndCovariance]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CorrelatedModelTest.LoadsAndChecksTheCovarianceSection]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=CorrelatedModelTest.LoadsAndChecksTheCovarianceSection]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CorrelatedModelTest.LoadsAndChecksTheCovarianceSection]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HistoricalModelTest.CurvesAreWrappedBlocksOfTheTable]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=HistoricalModelTest.CurvesAreWrappedBlocksOfTheTable]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HistoricalModelTest.CurvesAreWrappedBlocksOfTheTable]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HistoricalModelTest.RejectsMalformedTables]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=HistoricalModelTest.RejectsMalformedTables]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HistoricalModelTest.RejectsMalformedTables]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InflationModelTest.DeviationsFollowTheAutoregression]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=InflationModelTest.DeviationsFollowTheAutoregression]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[InflationModelTest.DeviationsFollowTheAutoregression]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InflationModelTest.ShocksMoveAgainstTheMarket]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=InflationModelTest.ShocksMoveAgainstTheMarket]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[InflationModelTest.ShocksMoveAgainstTheMarket]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InflationModelTest.ScheduleFollowsThePathInflation]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=InflationModelTest.ScheduleFollowsThePathInflation]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[InflationModelTest.ScheduleFollowsThePathInflation]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[InflationModelTest.StudyKeepsTheInflationModel]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=InflationModelTest.StudyKeepsTheInflationModel]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[InflationModelTest.StudyKeepsTheInflationModel]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LifeTableTest.QuantilesInvertTheSurvivalCurve]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=LifeTableTest.QuantilesInvertTheSurvivalCurve]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LifeTableTest.QuantilesInvertTheSurvivalCurve]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LifeTableTest.RejectsMalformedTables]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=LifeTableTest.RejectsMalformedTables]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LifeTableTest.RejectsMalformedTables]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LifeTableTest.SharedTableGivesPlausibleLifeExpectancies]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=LifeTableTest.SharedTableGivesPlausibleLifeExpectancies]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LifeTableTest.SharedTableGivesPlausibleLifeExpectancies]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LifeTableTest.DeathYearEndsTheRandomizedPaths]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=LifeTableTest.DeathYearEndsTheRandomizedPaths]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LifeTableTest.DeathYearEndsTheRandomizedPaths]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AliasTableTest.SamplesTheGivenDistribution]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=AliasTableTest.SamplesTheGivenDistribution]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AliasTableTest.SamplesTheGivenDistribution]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RegimeModelTest.FollowsTheTransitions]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=RegimeModelTest.FollowsTheTransitions]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RegimeModelTest.FollowsTheTransitions]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RegimeModelTest.RejectsInvalidModels]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=RegimeModelTest.RejectsInvalidModels]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RegimeModelTest.RejectsInvalidModels]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MonthlyEngineTest.BridgeIsTiedDownAtTheYearEnds]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=MonthlyEngineTest.BridgeIsTiedDownAtTheYearEnds]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MonthlyEngineTest.BridgeIsTiedDownAtTheYearEnds]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MonthlyEngineTest.GrowthWithoutCashFlowsMatchesAnnualSteps]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=MonthlyEngineTest.GrowthWithoutCashFlowsMatchesAnnualSteps]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MonthlyEngineTest.GrowthWithoutCashFlowsMatchesAnnualSteps]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MonthlyEngineTest.MonthlyDistributionsCoverTheExpense]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=MonthlyEngineTest.MonthlyDistributionsCoverTheExpense]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MonthlyEngineTest.MonthlyDistributionsCoverTheExpense]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MonthlyEngineTest.StudyKeepsTheTimeStep]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=MonthlyEngineTest.StudyKeepsTheTimeStep]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MonthlyEngineTest.StudyKeepsTheTimeStep]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MonthlyEngineTest.RejectsWhatMonthlyStepsDoNotModel]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=MonthlyEngineTest.RejectsWhatMonthlyStepsDoNotModel]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MonthlyEngineTest.RejectsWhatMonthlyStepsDoNotModel]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NdjsonStreamTest.ParseProfile]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=NdjsonStreamTest.ParseProfile]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NdjsonStreamTest.ParseProfile]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NdjsonStreamTest.ResultsInInputOrder]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=NdjsonStreamTest.ResultsInInputOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NdjsonStreamTest.ResultsInInputOrder]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ProfileBinaryTest.RoundTrip]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=ProfileBinaryTest.RoundTrip]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ProfileBinaryTest.RoundTrip]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ProfileBinaryTest.CorruptedFileFailsChecksum]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=ProfileBinaryTest.CorruptedFileFailsChecksum]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ProfileBinaryTest.CorruptedFileFailsChecksum]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ProfileBinaryTest.WrappingRecordCountIsRejected]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=ProfileBinaryTest.WrappingRecordCountIsRejected]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ProfileBinaryTest.WrappingRecordCountIsRejected]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ProfileBinaryTest.OutOfBoundsProfileIsNotCompiled]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=ProfileBinaryTest.OutOfBoundsProfileIsNotCompiled]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ProfileBinaryTest.OutOfBoundsProfileIsNotCompiled]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ProfileScheduleTest.CashFlowsFromUserData]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=ProfileScheduleTest.CashFlowsFromUserData]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ProfileScheduleTest.CashFlowsFromUserData]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ProfileScheduleTest.ScheduleKernelMatchesMemberPath]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=ProfileScheduleTest.ScheduleKernelMatchesMemberPath]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ProfileScheduleTest.ScheduleKernelMatchesMemberPath]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ProfileScheduleTest.AccumulationFastPathEligibility]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=ProfileScheduleTest.AccumulationFastPathEligibility]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ProfileScheduleTest.AccumulationFastPathEligibility]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ProfileScheduleTest.AccumulationFastPathValues]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=ProfileScheduleTest.AccumulationFastPathValues]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ProfileScheduleTest.AccumulationFastPathValues]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ProfileScheduleTest.LifeEventsOverlayTheExpense]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=ProfileScheduleTest.LifeEventsOverlayTheExpense]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ProfileScheduleTest.LifeEventsOverlayTheExpense]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ResultCacheTest.KeyIgnoresNamesOnly]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=ResultCacheTest.KeyIgnoresNamesOnly]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ResultCacheTest.KeyIgnoresNamesOnly]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ResultCacheTest.HitsAreIdenticalAndEvictionIsLru]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=ResultCacheTest.HitsAreIdenticalAndEvictionIsLru]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ResultCacheTest.HitsAreIdenticalAndEvictionIsLru]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RmdTableTest.AgeAndDivisorsFollowTheRules]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=RmdTableTest.AgeAndDivisorsFollowTheRules]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RmdTableTest.AgeAndDivisorsFollowTheRules]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RmdTableTest.ScheduleRequiresFromTheRmdAge]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=RmdTableTest.ScheduleRequiresFromTheRmdAge]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RmdTableTest.ScheduleRequiresFromTheRmdAge]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RmdSimulationTest.ForcedDistributionsFlowIntoIndividualAccount]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=RmdSimulationTest.ForcedDistributionsFlowIntoIndividualAccount]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RmdSimulationTest.ForcedDistributionsFlowIntoIndividualAccount]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SimServerTest.AnswersRequestsInOrder]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=SimServerTest.AnswersRequestsInOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SimServerTest.AnswersRequestsInOrder]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPoolTest.ParallelForVisitsEveryIndexOnce]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=ThreadPoolTest.ParallelForVisitsEveryIndexOnce]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadPoolTest.ParallelForVisitsEveryIndexOnce]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ScenarioBankTest.DeterminedBySeed]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=ScenarioBankTest.DeterminedBySeed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ScenarioBankTest.DeterminedBySeed]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SimulationTest.ConcurrentProfilesMatchSequential]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=SimulationTest.ConcurrentProfilesMatchSequential]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SimulationTest.ConcurrentProfilesMatchSequential]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SimulationTest.DeadlineReturnsPartialEstimate]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=SimulationTest.DeadlineReturnsPartialEstimate]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SimulationTest.DeadlineReturnsPartialEstimate]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SimulationTest.PastDeadlineBoundsBatchTime]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=SimulationTest.PastDeadlineBoundsBatchTime]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SimulationTest.PastDeadlineBoundsBatchTime]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StudyRunTest.ResumedRunMatchesUninterruptedRun]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=StudyRunTest.ResumedRunMatchesUninterruptedRun]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StudyRunTest.ResumedRunMatchesUninterruptedRun]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StudyRunTest.RejectsOtherProfilesAndCorruptFiles]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=StudyRunTest.RejectsOtherProfilesAndCorruptFiles]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StudyRunTest.RejectsOtherProfilesAndCorruptFiles]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StudyRunTest.EmptyStudyRunsNothing]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=StudyRunTest.EmptyStudyRunsNothing]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StudyRunTest.EmptyStudyRunsNothing]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StudyRunTest.MergedShardsMatchSingleRun]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=StudyRunTest.MergedShardsMatchSingleRun]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StudyRunTest.MergedShardsMatchSingleRun]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TaxTableTest.TaxesIncomeByTheBrackets]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=TaxTableTest.TaxesIncomeByTheBrackets]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TaxTableTest.TaxesIncomeByTheBrackets]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TaxTableTest.RejectsInvalidTables]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=TaxTableTest.RejectsInvalidTables]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TaxTableTest.RejectsInvalidTables]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TaxedSimulationTest.PreTaxSavingsLastShorter]=]  /root/repo/_test_build/tests/tests [==[--gtest_filter=TaxedSimulationTest.PreTaxSavingsLastShorter]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TaxedSimulationTest.PreTaxSavingsLastShorter]=]  PROPERTIES WORKING_DIRECTORY /root/repo SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  tests_TESTS AssetTest.StandardConstructor AssetTest.AddCashReserveSuccess AssetTest.AddCashReserveFail AssetTest.ClearCashReserve AssetTest.ConstantNoGrowthModel AssetTest.OneYearIncomeNoGrowthModel AssetTest.MultipleYearIncomeNoGrowthModel AssetTest.SimpleInflationNoGrowthModel AssetTest.SimpleGrowthNoInflationModel AssetTest.SimpleGrowthNoInflationModelMaxRange AssetTest.MaxLongevityNoGrowthModel AssetTest.SimpleIncomeSimplePensionNoInflationNoGrowthMaxModel AssetTest.SimpleIncomeSimplePensionNoInflationNoGrowthGapModel AssetTest.CashReserveDrawnAfterLossRefilledAfterGain AssetTest.CashReserveCoversShortfallWithoutGrowth AssetTest.SpendingRulesFollowThePortfolio UserDataLoadingTest.OutOfRangeLargeValue UserDataLoadingTest.MissingDataField UserDataLoadingTest.UnknownKeyInGeneralSection UserDataLoadingTest.CannotParseKeyValueInGeneralSection UserDataLoadingTest.LeadingPlusSignIsAccepted UserDataLoadingTest.BoundsCheckSuccess UserDataLoadingTest.BoundsCheckNegativeValue UserDataLoadingTest.BoundsCheckLargeValue UserDataLoadingTest.ErrorReportsLineAndColumn UserDataLoadingTest.EventsCompileIntoYearlyExpense HouseholdBookTest.LoadCsvBook HouseholdBookTest.LargeTsvBookKeepsOrderAndSkipsInvalid HouseholdBookTest.MalformedRow HouseholdBookTest.UnknownColumn CorrelatedModelTest.FactorReproducesTheCovariance CorrelatedModelTest.DefaultCovarianceFollowsTheStockRatio CorrelatedModelTest.RejectsInvalidMatrices CorrelatedModelTest.ReturnsHaveTheProfileMeanAndCovariance CorrelatedModelTest.LoadsAndChecksTheCovarianceSection HistoricalModelTest.CurvesAreWrappedBlocksOfTheTable HistoricalModelTest.RejectsMalformedTables InflationModelTest.DeviationsFollowTheAutoregression InflationModelTest.ShocksMoveAgainstTheMarket InflationModelTest.ScheduleFollowsThePathInflation InflationModelTest.StudyKeepsTheInflationModel LifeTableTest.QuantilesInvertTheSurvivalCurve LifeTableTest.RejectsMalformedTables LifeTableTest.SharedTableGivesPlausibleLifeExpectancies LifeTableTest.DeathYearEndsTheRandomizedPaths AliasTableTest.SamplesTheGivenDistribution RegimeModelTest.FollowsTheTransitions RegimeModelTest.RejectsInvalidModels MonthlyEngineTest.BridgeIsTiedDownAtTheYearEnds MonthlyEngineTest.GrowthWithoutCashFlowsMatchesAnnualSteps MonthlyEngineTest.MonthlyDistributionsCoverTheExpense MonthlyEngineTest.StudyKeepsTheTimeStep MonthlyEngineTest.RejectsWhatMonthlyStepsDoNotModel NdjsonStreamTest.ParseProfile NdjsonStreamTest.ResultsInInputOrder ProfileBinaryTest.RoundTrip ProfileBinaryTest.CorruptedFileFailsChecksum ProfileBinaryTest.WrappingRecordCountIsRejected ProfileBinaryTest.OutOfBoundsProfileIsNotCompiled ProfileScheduleTest.CashFlowsFromUserData ProfileScheduleTest.ScheduleKernelMatchesMemberPath ProfileScheduleTest.AccumulationFastPathEligibility ProfileScheduleTest.AccumulationFastPathValues ProfileScheduleTest.LifeEventsOverlayTheExpense ResultCacheTest.KeyIgnoresNamesOnly ResultCacheTest.HitsAreIdenticalAndEvictionIsLru RmdTableTest.AgeAndDivisorsFollowTheRules RmdTableTest.ScheduleRequiresFromTheRmdAge RmdSimulationTest.ForcedDistributionsFlowIntoIndividualAccount SimServerTest.AnswersRequestsInOrder ThreadPoolTest.ParallelForVisitsEveryIndexOnce ScenarioBankTest.DeterminedBySeed SimulationTest.ConcurrentProfilesMatchSequential SimulationTest.DeadlineReturnsPartialEstimate SimulationTest.PastDeadlineBoundsBatchTime StudyRunTest.ResumedRunMatchesUninterruptedRun StudyRunTest.RejectsOtherProfilesAndCorruptFiles StudyRunTest.EmptyStudyRunsNothing StudyRunTest.MergedShardsMatchSingleRun TaxTableTest.TaxesIncomeByTheBrackets TaxTableTest.RejectsInvalidTables TaxedSimulationTest.PreTaxSavingsLastShorter)
@@ -0,0 +1,101 @@
+/* ============================================================================
+ * aliasTable.h
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Declares the AliasTable class, which samples a discrete distribution in
+ *  constant time with Walker's alias method (built with Vose's algorithm).
+ *  Each column of the table keeps its own outcome with some probability
+ *  and otherwise yields its alias, so a sample is one column pick and one
+ *  comparison. Both come from the same 64 random bits: the high half
+ *  picks the column and the low half is compared with the column's
+ *  threshold.
+ *
+ *  Related Files:
+ *    - aliasTable.cpp
+ *
+ *  Created:    October 2026
+ *  Author:     Yuping X
+ * ============================================================================
+ */
+
+#ifndef ALIAS_TABLE_H_
+#define ALIAS_TABLE_H_
+
+#include <vector>
+#include <cstdint>
+
+/**
+ * @brief Constant-time sampler of a discrete distribution.
+ */
+class AliasTable {
+private:
+	/* A column: keeps outcome `column` if the low 32 random bits are below
+	 * threshold, else yields alias */
+	struct Column {
+		uint32_t threshold;
+		uint32_t alias;
+	};
+
+	std::vector<Column> columns_;
+
+public:
+	/**
+	 * @brief Creates an empty table; sample() must not be called on it.
+	 */
+	AliasTable() = default;
+
+	/**
+	 * @brief Builds the table of a distribution.
+	 *
+	 * @param weights Non-negative weights of the outcomes, not all zero;
+	 *        they need not sum to 1.
+	 * @throws std::runtime_error if the weights are invalid.
+	 */
+	explicit AliasTable(const std::vector<double>& weights);
+
+	/**
+	 * @brief Gets the number of outcomes.
+	 *
+	 * @return The number of outcomes.
+	 */
+	uint32_t size() const {
+		return static_cast<uint32_t>(columns_.size());
+	}
+
+	/**
+	 * @brief Draws an outcome.
+	 *
+	 * @param bits 64 uniformly random bits.
+	 * @return The index of the outcome, in [0, size()).
+	 */
+	uint32_t sample(uint64_t bits) const {
+		uint32_t column = static_cast<uint32_t>(((bits >> 32) * columns_.size()) >> 32);
+		const Column& entry = columns_[column];
+		return (static_cast<uint32_t>(bits) < entry.threshold) ? column : entry.alias;
+	}
+
+	/**
+	 * @brief Gets the threshold of a column, for callers that fuse the
+	 *        table with their outcomes.
+	 *
+	 * @param column Index of the column.
+	 * @return The column keeps its own outcome if the low 32 random bits
+	 *         are below the threshold.
+	 */
+	uint32_t threshold(uint32_t column) const {
+		return columns_[column].threshold;
+	}
+
+	/**
+	 * @brief Gets the alias of a column.
+	 *
+	 * @param column Index of the column.
+	 * @return The outcome yielded when the column does not keep its own.
+	 */
+	uint32_t alias(uint32_t column) const {
+		return columns_[column].alias;
+	}
+};
+
+#endif /* ALIAS_TABLE_H_ */
@@ -10,13 +10,14 @@
  *
  *  Core Responsibilities:
  *    - Maintain account-level value, availability, and growth data.
- *    - Simulate cash reserve replenishment or depletion.
+ *    - Simulate a cash reserve drawn after losses and refilled after gains.
  *    - Compute annual distributions to meet modeled expenses.
  *    - Project how long available funds can sustain the target expenses.
  *    - Populate growth curves based on predefined or randomized scenarios.
  *
  *  Public Interface Highlights:
  *    - calculateN(): Main driver that simulates fund longevity.
+ *    - calculateMonthlyN(): The same with monthly time steps.
  *    - populateGrowthCurves(): Builds per-asset growth rate projections.
  *    - addCashReserve(), clearCashReserve(): Manage cash buffer logic.
  *    - getFundLongevity(): Returns number of years the fund can last.
@@ -27,7 +28,14 @@
  *  Related Files:
  *    - Asset.cpp
  *    - constants.h
+ *    - profileSchedule.h / profileSchedule.cpp
  *    - modelRecession.h / modelRecession.cpp
+ *    - modelHistorical.h / modelHistorical.cpp
+ *    - modelRegime.h / modelRegime.cpp
+ *    - modelCorrelated.h / modelCorrelated.cpp
+ *    - taxModel.h / taxModel.cpp
+ *    - monthlyEngine.h / monthlyEngine.cpp
+ *    - spendingPolicy.h
  *
  *  Created: 	June 2025
  *  Author:     Yuping X
@@ -41,7 +49,12 @@
 #include <array>
 #include "constants.h"
 #include "modelRecession.h"
+#include "modelCorrelated.h"
 #include "userDataLoading.h"
+#include "profileSchedule.h"
+#include "monthlyEngine.h"
+
+class TaxTable;
 
 /**
  * @brief Represents and simulates the evolution of financial assets over time.
@@ -55,7 +68,7 @@ private:
 	int fundLongevity_;
 
 	/* Amount of active cash reserve. */
-	int cashReserve_;
+	long int cashReserve_;
 
 	/* 2D array for the dynamic growth rate for each year and each account. */
 	std::array<std::array<float, MAX_YEARS>, MAX_ACCOUNTS> growthRate_;
@@ -106,20 +119,61 @@ public:
 	/* Inflation rate vector by year */
 	std::array<float, MAX_YEARS> inflation_;
 
+	/* Average returns and covariance factor of the accounts, used by the
+	 * correlated per-account model */
+	ReturnFactor returnFactor_;
+
 private:
-    /**
-     * @brief Applies a predefined "year-0 loss" scenario to the growth curve.
+	/**
+     * @brief Applies a randomized recession scenario to the growth curve.
      * 
      * @param growth Output array for the scenario growth curve.
      */
-	void scenarioPredefinedYear0Loss(std::array<float, MAX_YEARS>& growth);
+	void scenarioRecessionRandomized(std::array<float, MAX_YEARS>& growth);
 
 	/**
-     * @brief Applies a randomized recession scenario to the growth curve.
+     * @brief Applies a block bootstrap of historical returns to the growth curve.
      * 
      * @param growth Output array for the scenario growth curve.
      */
-	void scenarioRecessionRandomized(std::array<float, MAX_YEARS>& growth);
+	void scenarioHistoricalBootstrap(std::array<float, MAX_YEARS>& growth);
+
+	/**
+     * @brief Applies a Markov regime-switching scenario to the growth curve.
+     * 
+     * @param growth Output array for the scenario growth curve.
+     */
+	void scenarioRegimeSwitching(std::array<float, MAX_YEARS>& growth);
+
+	/**
+     * @brief Draws correlated per-account returns into the growth curves.
+     */
+	void scenarioCorrelatedAccounts();
+
+	/**
+     * @brief Fast-forwards through the accumulation phase in closed form.
+     *
+     * Only valid when nothing is distributed before retirement (see
+     * ProfileSchedule::accumulationFastPath_). Each account then follows
+     * value[i+1] = value[i] * (1 + growth[i]) + contribution[i], so its value
+     * in the last accumulation year is the starting value times the product
+     * of all growth factors plus each contribution times the product of the
+     * growth factors that follow it. Distributions in the skipped years are
+     * zero; values in the intermediate years are not materialized.
+     *
+     * @param schedule Deterministic per-year cash flows of the profile.
+     * @return The year the regular year-by-year simulation resumes from.
+     */
+	int fastForwardAccumulation(const ProfileSchedule& schedule);
+
+	/**
+     * @brief The yearly loop of calculateN() for one spending rule.
+     *
+     * @tparam Policy Spending rule (see spendingPolicy.h), whose state
+     *         lives for the one path.
+     */
+	template <class Policy>
+	void calculateWithPolicy(const ProfileSchedule& schedule, const TaxTable* tax, int horizon);
 
 public:
     /**
@@ -134,7 +188,7 @@ public:
      * 
      * @return The cash reserve amount.
      */
-	int getCashReserve();
+	long int getCashReserve();
 
 	/**
      * @brief Adds a cash reserve by taking fund out of a given investment.
@@ -144,7 +198,7 @@ public:
      * @param n_year Target year of withdrawal.
      * @return true if the reserve was added successfully.
      */
-	bool addCashReserve(int cash, int asset_num, int n_year);
+	bool addCashReserve(long int cash, int asset_num, int n_year);
 
 	/**
      * @brief Clears the cash reserve value.
@@ -158,11 +212,91 @@ public:
      */
 	void populateGrowthCurves(const ModelOption option);
 
+	/**
+     * @brief Populates growth curves from a given common growth curve.
+     *
+     * Each account's curve is the common (stock market) curve scaled by the
+     * account's guessed stock ratio.
+     *
+     * @param growth_common Common growth curve, e.g. from a ScenarioBank.
+     */
+	void populateGrowthCurves(const std::array<float, MAX_YEARS>& growth_common);
+
+	/**
+     * @brief Populates growth curves from a given common growth curve and
+     *        the accounts' stock ratios, computed once per profile.
+     *
+     * @param growth_common Common growth curve, e.g. from a ScenarioBank.
+     * @param stock_ratio Stock ratio of each account, from stockRatios().
+     */
+	void populateGrowthCurves(const std::array<float, MAX_YEARS>& growth_common,
+	                          const std::array<float, MAX_ACCOUNTS>& stock_ratio);
+
+	/**
+     * @brief Gets the guessed stock ratio of each account: its average
+     *        growth rate over the stock market's, at most 1.
+     *
+     * @return The ratio of each account.
+     */
+	std::array<float, MAX_ACCOUNTS> stockRatios() const;
+
+	/**
+     * @brief Sets the growth curve of every account.
+     *
+     * @param growth Growth curves of the accounts, e.g. from correlateReturns().
+     */
+	void populateGrowthCurves(const AccountCurves& growth);
+
 	/**
      * @brief Calculates fund longevity and simulates asset behavior.
+     *
+     * Builds a ProfileSchedule from the current data members (year-0 values,
+     * income, contributions, inflation and availability) and simulates it
+     * against the current growth curves.
      */
 	void calculateN();
 
+	/**
+     * @brief Calculates fund longevity from a precomputed schedule.
+     *
+     * This is the per-iteration kernel: it combines the profile-invariant
+     * cash flows of the schedule with the current growth curves. With a
+     * tax table, each year's tax on its pension, distributions and gains
+     * is paid the following year (see taxModel.h); the individual
+     * account's year-0 value is taken as its cost basis. The tax-deferred
+     * accounts distribute at least their required minimum of the year
+     * (see ProfileSchedule::rmdRate_), and what they distribute beyond
+     * the net expense is reinvested in the individual account. The
+     * profile's spending rule adjusts the net expense of each year to the
+     * path (see spendingPolicy.h).
+     *
+     * @param schedule Deterministic per-year cash flows of the profile.
+     * @param tax Tax brackets, or nullptr to spend distributions untaxed.
+     * @param horizon Number of years to simulate, e.g. up to the death
+     *        year of a path (see modelMortality.h). The fund longevity is
+     *        at most the horizon.
+     */
+	void calculateN(const ProfileSchedule& schedule, const TaxTable* tax = nullptr,
+	                int horizon = MAX_YEARS);
+
+	/**
+     * @brief Calculates fund longevity with monthly time steps.
+     *
+     * The monthly counterpart of calculateN(): the net expense and the tax
+     * are distributed every month, and contributions made at the end of
+     * every month, against the intra-year levels of the accounts (see
+     * monthlyEngine.h). Records the year-start values and the yearly
+     * distributions like calculateN().
+     *
+     * @param schedule Monthly cash flows of the profile.
+     * @param bridge Brownian bridges of the path, or nullptr for the
+     *        deterministic models.
+     * @param tax Tax brackets, or nullptr to spend distributions untaxed.
+     * @param horizon Number of years to simulate, as for calculateN().
+     */
+	void calculateMonthlyN(const MonthlySchedule& schedule, const MonthlyBridge* bridge,
+	                       const TaxTable* tax = nullptr, int horizon = MAX_YEARS);
+
 	/**
 	 * @brief Initializes Asset data members using user financial input.
 	 *
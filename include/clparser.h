@@ -17,13 +17,96 @@
 #ifndef CLPARSER_H_
 #define CLPARSER_H_
 #include <string>
+#include <vector>
+#include <cstdint>
 #include "../include/userDataLoading.h"
+#include "../include/simServer.h"
+#include "../include/resultCache.h"
+#include "../include/studyRun.h"
 
 /* If left unspecified by the user, default userdata profile is
  * demo_profile.ini 
  */
 struct ClArgs {
     std::string filename = USERDATA_DIR + "demo" + USERDATA_FILE_ENDING;;
+
+    /* Profiles given with --user (names or globs) and --user-list, in order.
+     * Empty if none was given, in which case filename is used unless a book
+     * or compiled profiles are given. */
+    std::vector<std::string> userFiles;
+
+    /* Household book (CSV or TSV) to simulate instead of a single profile */
+    std::string bookFile;
+
+    /* Compiled binary profiles to simulate instead of a single profile */
+    std::string compiledFile;
+
+    /* Compile the input profiles to a binary file instead of simulating */
+    bool compile = false;
+
+    /* Output of the compile step; defaults to the input file name with the
+     * PROFILE_BINARY_FILE_ENDING extension */
+    std::string outputFile;
+
+    /* Seed of the randomized model; a clock seed is used if not given */
+    bool seedGiven = false;
+    uint64_t seed = 0;
+
+    /* Randomized growth model (--model recession|historical|regime|correlated) */
+    bool modelGiven = false;
+    ModelOption randomModel = ModelOption::RECESSION_RANDOMIZED;
+
+    /* Inflation model of the randomized paths (--inflation constant|stochastic) */
+    bool inflationGiven = false;
+    InflationOption inflationModel = InflationOption::CONSTANT;
+
+    /* Tax model of the simulation (--tax none|federal) */
+    bool taxGiven = false;
+    TaxOption taxModel = TaxOption::NONE;
+
+    /* Time step of the simulation (--step annual|monthly) */
+    bool stepGiven = false;
+    StepOption stepOption = StepOption::ANNUAL;
+
+    /* Mortality model of the randomized paths (--mortality none|life-table) */
+    bool mortalityGiven = false;
+    MortalityOption mortalityOption = MortalityOption::NONE;
+
+    /* Number of simulation threads; 0 uses one per hardware thread */
+    unsigned int threads = 0;
+
+    /* Stream NDJSON profiles from stdin to NDJSON results on stdout */
+    bool stdinNdjson = false;
+
+    /* Serve simulation requests on a Unix domain socket (pfsim serve) */
+    bool serve = false;
+    std::string socketPath = SERVER_DEFAULT_SOCKET;
+
+    /* Maximum number of streamed profiles in flight; 0 uses the default */
+    size_t inFlight = 0;
+
+    /* Latency budget of each profile in milliseconds; 0 runs all iterations */
+    unsigned int deadlineMs = 0;
+
+    /* Memory bound of the result cache of streamed profiles; 0 disables it */
+    size_t cacheMb = RESULT_CACHE_DEFAULT_MB;
+
+    /* Number of randomized iterations of a study; 0 uses ITERATIONS, or
+     * the count of the resumed checkpoint */
+    uint64_t iterations = 0;
+
+    /* Checkpoint file of a study, saved every checkpointSeconds */
+    std::string checkpointFile;
+    unsigned int checkpointSeconds = STUDY_CHECKPOINT_SECONDS;
+
+    /* Resume the study saved in checkpointFile */
+    bool resume = false;
+
+    /* Run only shard shardIndex of shardCount of the study's iterations,
+     * saving its partial results to checkpointFile for pfsim-merge */
+    bool shardGiven = false;
+    uint64_t shardIndex = 0;
+    uint64_t shardCount = 1;
 };
 
 /**
@@ -76,11 +76,11 @@ const float MAX_AVG_GROWTH = 0.3;
 const unsigned int MAX_ACCOUNTS = 4;
 
 /**
- * There is some starting code for the cash reserve logic but it's not fully
- * implemented yet in v0.1. `CASH_RESERVE` is set to be `0` and please
- * DO NOT EDIT.
+ * @brief Largest cash reserve target, in years of net expense.
+ *
+ * The cash reserve of a profile (Cash-reserve-years) is off by default.
  */
-const unsigned int CASH_RESERVE = 0;
+const float MAX_CASH_RESERVE_YEARS = 10;
 
 /**
  * @brief enum for Asset account types
@@ -0,0 +1,71 @@
+/* ============================================================================
+ * householdBook.h
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Declares the function interface for bulk loading a book of households
+ *  from a single CSV or TSV file, one household per row.
+ *
+ *  File Format:
+ *    The first row is a header naming the columns, in any order:
+ *      - Household: identifier of the household
+ *      - Individual, Individual_roth, Individual_ira, 401k: starting value
+ *        of each account
+ *      - Individual-rate, Individual_roth-rate, Individual_ira-rate,
+ *        401k-rate: average growth rate of each account
+ *      - the [General] keys of the INI profile, e.g. Cost-of-living
+ *    All columns are required, except the optional [General] keys
+ *    (Birth-year, Cash-reserve-years, Cash-reserve-refill, Sex,
+ *    Spending-rule), which are 0 when left out. Fields are separated by
+ *    tabs if the header contains a tab, by commas otherwise. Quoted fields
+ *    are not supported.
+ *
+ *  Dependencies:
+ *    - userDataLoading.h
+ *
+ *  Related Files:
+ *    - householdBook.cpp
+ *    - data/demo_book.csv
+ *
+ *  Created:    October 2026
+ *  Author:     Yuping X
+ * ============================================================================
+ */
+
+#ifndef HOUSEHOLD_BOOK_H_
+#define HOUSEHOLD_BOOK_H_
+
+#include <string>
+#include <array>
+#include <vector>
+#include "constants.h"
+#include "userDataLoading.h"
+
+/* Column holding the household identifier */
+const std::string BOOK_ID_COLUMN = "Household";
+
+/* Account names, also used as the columns of the account values */
+const std::array<std::string, MAX_ACCOUNTS> BOOK_ACCOUNT_NAMES = {
+	"Individual", "Individual_roth", "Individual_ira", "401k"
+};
+
+/* Suffix of the columns of the account growth rates */
+const std::string BOOK_RATE_SUFFIX = "-rate";
+
+/* Minimum number of bytes parsed by one thread */
+const size_t BOOK_MIN_CHUNK_BYTES = 64 * 1024;
+
+/**
+ * @brief Loads all households of a CSV or TSV book.
+ *
+ * The file is memory-mapped and split into row ranges that are parsed and
+ * validated (see userDataWithinBounds()) in parallel. Households with
+ * out-of-bounds values are reported and skipped.
+ *
+ * @param filename Path to the book file.
+ * @return The valid households, in file order.
+ * @throws std::runtime_error on a malformed header or row.
+ */
+std::vector<UserData> loadHouseholdBook(const std::string& filename);
+
+#endif /* HOUSEHOLD_BOOK_H_ */
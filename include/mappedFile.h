@@ -0,0 +1,68 @@
+/* ============================================================================
+ * mappedFile.h
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Declares the MappedFile class, a read-only memory mapping of a whole file.
+ *  Used by the bulk input paths to access large input files without copying
+ *  them into memory.
+ *
+ *  Related Files:
+ *    - mappedFile.cpp
+ *
+ *  Created:    October 2026
+ *  Author:     Yuping X
+ * ============================================================================
+ */
+
+#ifndef MAPPED_FILE_H_
+#define MAPPED_FILE_H_
+
+#include <string>
+#include <string_view>
+#include <cstddef>
+
+/**
+ * @brief Read-only memory mapping of a file, unmapped on destruction.
+ */
+class MappedFile {
+private:
+	/* Start of the mapping (nullptr for an empty file) */
+	const char* data_;
+
+	/* Size of the file in bytes */
+	size_t size_;
+
+public:
+	/**
+	 * @brief Maps the whole file into memory.
+	 *
+	 * @param filename Path to the file.
+	 * @throws std::runtime_error if the file cannot be opened or mapped.
+	 */
+	explicit MappedFile(const std::string& filename);
+
+	/**
+	 * @brief Unmaps the file.
+	 */
+	~MappedFile();
+
+	/**
+	 * @brief Gets the file contents.
+	 *
+	 * @return View of the mapped bytes.
+	 */
+	std::string_view data() const;
+
+	/**
+	 * @brief Copy constructor (disallowed).
+	 */
+	MappedFile(const MappedFile&) = delete;
+
+	/**
+	 * @brief Copy assignment operator (disallowed).
+	 */
+	MappedFile& operator=(const MappedFile&) = delete;
+};
+
+#endif /* MAPPED_FILE_H_ */
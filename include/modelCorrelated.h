@@ -0,0 +1,144 @@
+/* ============================================================================
+ * modelCorrelated.h
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Declares the correlated per-account growth model. The other models scale
+ *  one common (stock market) curve by each account's stock ratio, so all
+ *  accounts move in lockstep. Here each account's yearly return is its
+ *  average return plus a random deviation, and the deviations of the
+ *  accounts follow the covariance matrix of the profile, so that a bond-
+ *  heavy account can gain in a year the stock-heavy ones lose.
+ *
+ *  The deviations are L * z, where L is the lower Cholesky factor of the
+ *  covariance matrix and z a vector of independent unit-variance draws.
+ *  The z do not depend on the profile, so a scenario bank holds them once
+ *  for every profile of a run; L is factored once per profile. Turning the
+ *  draws of a batch of paths into returns is then one small matrix
+ *  multiply (see correlateReturns()).
+ *
+ *  The unit draws come from a table of the quantiles of the standard
+ *  normal distribution, indexed by NORMAL_TABLE_BITS random bits, so that
+ *  a 64-bit draw yields several of them without any transcendental call.
+ *  Banks store the 16-bit table indexes rather than the draws, which halves
+ *  the memory streamed through by every profile.
+ *
+ *  Profile Format:
+ *    An optional [Covariance] section with one row per account, in the
+ *    order of the [Assets] section (see data/demo_profile.ini):
+ *      account_type = cov_1, cov_2, cov_3, cov_4
+ *    Without it, each account's volatility is STOCK_VOLATILITY times its
+ *    guessed stock ratio and every pair of accounts is correlated by
+ *    ACCOUNT_CORRELATION_DEFAULT.
+ *
+ *  Dependencies:
+ *    - constants.h
+ *    - scenarioRng.h
+ *    - userDataLoading.h
+ *
+ *  Related Files:
+ *    - modelCorrelated.cpp
+ *
+ *  Created:    October 2026
+ *  Author:     Yuping X
+ * ============================================================================
+ */
+
+#ifndef CORRELATED_MODEL_H_
+#define CORRELATED_MODEL_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "constants.h"
+#include "scenarioRng.h"
+#include "userDataLoading.h"
+
+/* Yearly volatility (standard deviation of the return) of the stock market */
+const float STOCK_VOLATILITY = 0.18;
+
+/* Correlation of every pair of accounts when the profile gives no covariance */
+const float ACCOUNT_CORRELATION_DEFAULT = 0.8;
+
+/* Tolerance of the symmetry and positive semi-definiteness checks */
+const float COVARIANCE_TOLERANCE = 1e-6;
+
+/* Number of random bits per unit draw; the quantile table has 2^bits entries */
+const unsigned int NORMAL_TABLE_BITS = 12;
+const unsigned int NORMAL_TABLE_SIZE = 1u << NORMAL_TABLE_BITS;
+
+/* Number of paths whose returns are computed at a time; their curves
+ * (12.8 KB) stay in the L1 cache until each path is simulated */
+const unsigned int CORRELATED_BATCH_PATHS = 16;
+
+/**
+ * @brief Growth curve of every account.
+ */
+using AccountCurves = std::array<std::array<float, MAX_YEARS>, MAX_ACCOUNTS>;
+
+/**
+ * @brief Unit draws of every account, as indexes into normalQuantiles().
+ */
+using AccountDraws = std::array<std::array<uint16_t, MAX_YEARS>, MAX_ACCOUNTS>;
+
+/**
+ * @brief Average returns and Cholesky factor of the return covariance of
+ *        the accounts of a profile.
+ */
+struct ReturnFactor {
+	/* Average return of each account */
+	std::array<float, MAX_ACCOUNTS> mean;
+
+	/* Lower triangular factor L, with L * L^T the covariance matrix */
+	std::array<std::array<float, MAX_ACCOUNTS>, MAX_ACCOUNTS> lower;
+};
+
+/**
+ * @brief Tells whether a profile gives its own covariance matrix.
+ *
+ * @param user Profile to check.
+ * @return False if the matrix is all zeros, i.e. the default is used.
+ */
+bool hasCovariance(const UserData& user);
+
+/**
+ * @brief Factors the covariance matrix of a profile, or its default one.
+ *
+ * Accounts with zero variance are allowed: their column of the factor is
+ * zero.
+ *
+ * @param user Profile to factor.
+ * @param factor Set to the factor; negative pivots of an invalid matrix
+ *        are clamped to zero.
+ * @return True if the matrix is symmetric and positive semi-definite.
+ */
+bool factorCovariance(const UserData& user, ReturnFactor& factor);
+
+/**
+ * @brief Generates the unit draws of one path.
+ *
+ * @param draws Output draws of every account and year.
+ * @param generator Random number generator to draw from.
+ */
+void generateAccountDraws(AccountDraws& draws, ScenarioRng& generator);
+
+/**
+ * @brief Turns the unit draws of a batch of paths into account returns.
+ *
+ * @param factor Factor of the profile.
+ * @param draws Unit draws of the paths, one after the other.
+ * @param paths Number of paths.
+ * @param growth Output growth curves of the paths.
+ */
+void correlateReturns(const ReturnFactor& factor, const AccountDraws* draws, size_t paths,
+                      AccountCurves* growth);
+
+/**
+ * @brief Gets the quantile table of the standard normal distribution, built
+ *        on first use and scaled to exactly unit variance.
+ *
+ * @return The table.
+ */
+const std::array<float, NORMAL_TABLE_SIZE>& normalQuantiles();
+
+#endif /* CORRELATED_MODEL_H_ */
@@ -0,0 +1,119 @@
+/* ============================================================================
+ * modelHistorical.h
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Declares the historical block-bootstrap growth model: each growth curve
+ *  is assembled from blocks of consecutive years of an annual historical
+ *  returns table, drawn with replacement. Blocks keep the year-to-year
+ *  shape of real crashes and recoveries, which single-year resampling or
+ *  the stylized recession model do not.
+ *
+ *  The table is loaded once per process. It is stored unrolled by one
+ *  block (the first years repeated after the last ones), so that every
+ *  block start is valid, wraps around without a modulo, and a block is a
+ *  single contiguous copy: a 50-year curve costs one random draw and one
+ *  copy per block.
+ *
+ *  Table Format:
+ *    CSV with a "Year,Return" header and one year per line, returns as
+ *    fractions (0.05 for 5%). Lines starting with # are comments.
+ *
+ *  Dependencies:
+ *    - constants.h
+ *    - scenarioRng.h
+ *
+ *  Related Files:
+ *    - modelHistorical.cpp
+ *    - data/historical_returns.csv
+ *
+ *  Created:    October 2026
+ *  Author:     Yuping X
+ * ============================================================================
+ */
+
+#ifndef HISTORICAL_MODEL_H_
+#define HISTORICAL_MODEL_H_
+
+#include <array>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "constants.h"
+#include "scenarioRng.h"
+
+/* Historical returns table used by the model */
+const std::string HISTORICAL_RETURNS_FILE = "data/historical_returns.csv";
+
+/* Number of consecutive historical years per bootstrap block */
+const unsigned int HISTORICAL_BLOCK_YEARS = 5;
+
+/**
+ * @brief Annual historical returns, prepared for block bootstrapping.
+ */
+class HistoricalReturns {
+private:
+	/* Returns of every year, followed by those of the first
+	 * HISTORICAL_BLOCK_YEARS - 1 years again */
+	std::vector<float> unrolled_;
+
+	/* Number of historical years */
+	uint32_t years_;
+
+	/* Checksum of the returns, identifying the table */
+	uint64_t checksum_;
+
+public:
+	/**
+	 * @brief Loads a returns table.
+	 *
+	 * @param filename Path to the CSV file.
+	 * @throws std::runtime_error if the file cannot be read, is malformed,
+	 *         or holds fewer years than one block.
+	 */
+	explicit HistoricalReturns(const std::string& filename);
+
+	/**
+	 * @brief Gets the table of HISTORICAL_RETURNS_FILE, loaded on first use.
+	 *
+	 * @return The shared table.
+	 * @throws std::runtime_error if the file cannot be loaded.
+	 */
+	static const HistoricalReturns& shared();
+
+	/**
+	 * @brief Gets the number of historical years.
+	 *
+	 * @return The number of years; every one is a valid block start.
+	 */
+	uint32_t years() const;
+
+	/**
+	 * @brief Gets the checksum of the returns.
+	 *
+	 * @return The checksum.
+	 */
+	uint64_t checksum() const;
+
+	/**
+	 * @brief Gets the returns of a block.
+	 *
+	 * @param start First historical year of the block, in [0, years()).
+	 * @return Pointer to HISTORICAL_BLOCK_YEARS consecutive returns.
+	 */
+	const float* block(uint32_t start) const {
+		return unrolled_.data() + start;
+	}
+};
+
+/**
+ * @brief Generates a growth curve by block-bootstrapping historical returns.
+ *
+ * @param growth Output array for the common (stock market) growth curve.
+ * @param generator Random number generator to draw from.
+ * @param table Historical returns to resample.
+ */
+void generateHistoricalBootstrap(std::array<float, MAX_YEARS>& growth, ScenarioRng& generator,
+                                 const HistoricalReturns& table);
+
+#endif /* HISTORICAL_MODEL_H_ */
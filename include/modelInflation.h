@@ -0,0 +1,95 @@
+/* ============================================================================
+ * modelInflation.h
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Declares the stochastic inflation model. By default every path of a
+ *  randomized run inflates expenses, income and contributions by the
+ *  profile's constant inflation rate. With stochastic inflation, each path
+ *  has its own inflation curve, drawn jointly with its market returns:
+ *
+ *    1 + inflation_n = (1 + profile inflation) * (1 + d_n)
+ *    d_n = INFLATION_PERSISTENCE * d_(n-1) + INFLATION_VOLATILITY * e_n
+ *
+ *  a mean-reverting AR(1) deviation from the profile's rate, with d_(-1) = 0.
+ *  The unit shocks e_n are correlated by INFLATION_MARKET_CORRELATION with
+ *  the standardized market return of the same year, so that high-inflation
+ *  years tend to be poor market years. The correlated per-account model has
+ *  no common market curve; its shocks are independent of the returns.
+ *
+ *  The deviations d do not depend on the profile, so a scenario bank draws
+ *  them once, right after the growth curve of each path and from the same
+ *  random stream. Being multiplicative, their cumulative product is also
+ *  profile independent and drawn with them, so that each profile re-inflates
+ *  its cash flows path by path with one product per year and no dependency
+ *  between years (see ProfileSchedule::inflate()).
+ *
+ *  Dependencies:
+ *    - constants.h
+ *    - scenarioRng.h
+ *
+ *  Related Files:
+ *    - modelInflation.cpp
+ *    - scenarioBank.h / scenarioBank.cpp
+ *    - profileSchedule.h / profileSchedule.cpp
+ *
+ *  Created:    October 2026
+ *  Author:     Yuping X
+ * ============================================================================
+ */
+
+#ifndef INFLATION_MODEL_H_
+#define INFLATION_MODEL_H_
+
+#include <array>
+#include <cstdint>
+#include "constants.h"
+#include "scenarioRng.h"
+
+/**
+ * @brief Inflation models of the randomized paths.
+ */
+enum class InflationOption : uint32_t {
+	/* The profile's inflation rate in every year of every path */
+	CONSTANT = 0,
+
+	/* A mean-reverting random inflation curve per path */
+	STOCHASTIC = 1,
+
+	MAX = STOCHASTIC
+};
+
+/* Share of last year's deviation from the profile's rate carried into this
+ * year; deviations halve in about two years */
+const float INFLATION_PERSISTENCE = 0.7;
+
+/* Standard deviation of the yearly inflation shock; the deviation from the
+ * profile's rate then has a long-run standard deviation of about 1.7% */
+const float INFLATION_VOLATILITY = 0.012;
+
+/* Correlation of the inflation shock with the market return of the year */
+const float INFLATION_MARKET_CORRELATION = -0.3;
+
+/**
+ * @brief Inflation deviations of one path.
+ */
+struct InflationPath {
+	/* Deviation d_n of each year's inflation from the profile's rate */
+	std::array<float, MAX_YEARS> deviation;
+
+	/* Product of (1 + d_k) over the years k before each year */
+	std::array<float, MAX_YEARS> growth;
+};
+
+/**
+ * @brief Generates the inflation deviations of one path.
+ *
+ * @param path Output deviations of the path.
+ * @param generator Random number generator to draw from.
+ * @param market Common (stock market) growth curve of the path the shocks
+ *        are correlated with, or nullptr for independent shocks.
+ */
+void generateInflationPath(InflationPath& path, ScenarioRng& generator,
+                           const std::array<float, MAX_YEARS>* market);
+
+#endif /* INFLATION_MODEL_H_ */
@@ -0,0 +1,154 @@
+/* ============================================================================
+ * modelMortality.h
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Declares the optional mortality model. By default a path is judged
+ *  against the fixed MAX_YEARS horizon. With the life-table model, each
+ *  path also draws the year its profile's owner dies, from a period life
+ *  table by age and sex, and the path is simulated up to that year only:
+ *  what matters is whether the money outlives the person, and paths that
+ *  end early are cheaper to simulate.
+ *
+ *  The death year is drawn by inverse transform. For every sex and age,
+ *  the inverse of the distribution of the remaining years of life is
+ *  tabulated at MORTALITY_TABLE_SIZE evenly spaced quantiles when the
+ *  table is loaded, so a draw is one lookup with the top bits of a random
+ *  number. The draws do not depend on the profile, so a scenario bank
+ *  draws them once per path, after everything else; profiles of different
+ *  ages sharing a path share its quantile.
+ *
+ *  Table Format:
+ *    CSV with an "Age,Male,Female" header and one age per line from 0 to
+ *    LIFE_TABLE_AGES - 1, giving the probability of dying within the year
+ *    at that age. Nobody outlives the last age. Lines starting with # are
+ *    comments.
+ *
+ *  Dependencies:
+ *    - constants.h
+ *    - userDataLoading.h
+ *
+ *  Related Files:
+ *    - modelMortality.cpp
+ *    - data/life_table.csv
+ *
+ *  Created:    October 2026
+ *  Author:     Yuping X
+ * ============================================================================
+ */
+
+#ifndef MORTALITY_MODEL_H_
+#define MORTALITY_MODEL_H_
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "constants.h"
+#include "userDataLoading.h"
+
+/**
+ * @brief Mortality models of a simulation run.
+ */
+enum class MortalityOption : uint32_t {
+	/* Every path runs the full MAX_YEARS horizon */
+	NONE = 0,
+
+	/* Every path runs until a death year drawn from the life table */
+	LIFE_TABLE = 1,
+
+	MAX = LIFE_TABLE
+};
+
+/* Life table used by the model */
+const std::string LIFE_TABLE_FILE = "data/life_table.csv";
+
+/* Number of ages of the life table, from 0 */
+const unsigned int LIFE_TABLE_AGES = 120;
+
+/* Sex codes of UserData::sex. Without one, the death probabilities of
+ * both sexes are averaged. */
+const unsigned short SEX_UNKNOWN = 0;
+const unsigned short SEX_MALE = 1;
+const unsigned short SEX_FEMALE = 2;
+const unsigned int LIFE_TABLE_SEXES = 3;
+
+/* Number of tabulated quantiles of each age and sex, as a power of 2 */
+const unsigned int MORTALITY_TABLE_BITS = 10;
+const unsigned int MORTALITY_TABLE_SIZE = 1u << MORTALITY_TABLE_BITS;
+
+/**
+ * @brief Period life table, prepared for inverse-transform sampling.
+ */
+class LifeTable {
+private:
+	/* Remaining full years of life at each quantile, by sex and age: entry
+	 * (sex * LIFE_TABLE_AGES + age) * MORTALITY_TABLE_SIZE + j is the year
+	 * of death, counted from the current year, at quantile (j + 0.5) /
+	 * MORTALITY_TABLE_SIZE */
+	std::vector<uint8_t> yearsLeft_;
+
+	/* Checksum of the death probabilities, identifying the table */
+	uint64_t checksum_;
+
+public:
+	/**
+	 * @brief Loads a life table.
+	 *
+	 * @param filename Path to the CSV file.
+	 * @throws std::runtime_error if the file cannot be read or is malformed.
+	 */
+	explicit LifeTable(const std::string& filename);
+
+	/**
+	 * @brief Gets the table of LIFE_TABLE_FILE, loaded on first use.
+	 *
+	 * @return The shared table.
+	 * @throws std::runtime_error if the file cannot be loaded.
+	 */
+	static const LifeTable& shared();
+
+	/**
+	 * @brief Gets the checksum of the death probabilities.
+	 *
+	 * @return The checksum.
+	 */
+	uint64_t checksum() const;
+
+	/**
+	 * @brief Gets the tabulated quantiles of the remaining years of life.
+	 *
+	 * @param sex Sex code (see SEX_UNKNOWN).
+	 * @param age Age in the current year; ages past the table are taken
+	 *        as its last one.
+	 * @return MORTALITY_TABLE_SIZE years of death from the current year,
+	 *         in increasing order, to be indexed by deathYear().
+	 */
+	const uint8_t* quantiles(unsigned int sex, unsigned int age) const {
+		age = (age < LIFE_TABLE_AGES) ? age : LIFE_TABLE_AGES - 1;
+		return yearsLeft_.data() + (size_t(sex) * LIFE_TABLE_AGES + age) * MORTALITY_TABLE_SIZE;
+	}
+
+	/**
+	 * @brief Draws the year of death of a path.
+	 *
+	 * @param quantiles Quantiles of the person, from quantiles().
+	 * @param bits 32 uniformly random bits of the path.
+	 * @return The year of death, counted from the current year.
+	 */
+	static unsigned int deathYear(const uint8_t* quantiles, uint32_t bits) {
+		return quantiles[bits >> (32 - MORTALITY_TABLE_BITS)];
+	}
+};
+
+/**
+ * @brief Gets the quantiles of the remaining years of life of a profile's
+ *        owner.
+ *
+ * @param user User financial profile.
+ * @param table Life table to use.
+ * @return The quantiles, or nullptr if the profile has no birth year, in
+ *         which case its paths run the full horizon.
+ */
+const uint8_t* profileLifeQuantiles(const UserData& user, const LifeTable& table);
+
+#endif /* MORTALITY_MODEL_H_ */
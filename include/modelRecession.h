@@ -16,6 +16,8 @@
 #define RECESSIONMODEL_H_
 
 #include <array>
+#include "constants.h"
+#include "scenarioRng.h"
 
 enum class ModelOption : int {
 	/* Constant growth model*/
@@ -26,11 +28,32 @@ enum class ModelOption : int {
 
 	/* A randomized growth model based on recession assumptions */
 	RECESSION_RANDOMIZED = 2,
+
+	/* A randomized growth model resampling blocks of historical returns */
+	HISTORICAL_BOOTSTRAP = 3,
+
+	/* A randomized growth model switching between market regimes */
+	REGIME_SWITCHING = 4,
+
+	/* A randomized growth model drawing correlated returns per account */
+	CORRELATED_ACCOUNTS = 5,
 	
 	MIN = CONSTANT,
-	MAX = RECESSION_RANDOMIZED
+	MAX = CORRELATED_ACCOUNTS
 };
 
+/**
+ * @brief Tells whether a model draws a new growth curve per iteration
+ *        (from a scenario bank) rather than using a fixed one.
+ *
+ * @param option The growth model.
+ * @return True for the randomized models.
+ */
+inline bool isRandomizedModel(ModelOption option) {
+	return (option == ModelOption::RECESSION_RANDOMIZED) || (option == ModelOption::HISTORICAL_BOOTSTRAP) || \
+	       (option == ModelOption::REGIME_SWITCHING) || (option == ModelOption::CORRELATED_ACCOUNTS);
+}
+
 /* The average yearly return of the S&P 500 is 9% over the last 30 years,
  * 11.3% over the last 10 years.
  * This assumes dividends are reinvested.
@@ -73,4 +96,12 @@ const std::array<float, MAX_YEARS> RECESSION_YEAR0_LOSS = \
 const unsigned int RANDOM_NUM_MIN = 1;
 const unsigned int RANDOM_NUM_MAX = 100;
 
+/**
+ * @brief Generates a randomized recession growth curve.
+ *
+ * @param growth Output array for the common (stock market) growth curve.
+ * @param generator Random number generator to draw from.
+ */
+void generateRecessionRandomized(std::array<float, MAX_YEARS>& growth, ScenarioRng& generator);
+
 #endif /* RECESSIONMODEL_H_ */
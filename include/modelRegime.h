@@ -0,0 +1,146 @@
+/* ============================================================================
+ * modelRegime.h
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Declares the Markov regime-switching growth model. Each year the market
+ *  is in one regime (expansion, recession or recovery); next year's regime
+ *  follows a configurable transition matrix, and each regime's return is
+ *  drawn from its own configurable discrete distribution. Unlike the
+ *  randomized recession model, recession timing and length are not fixed
+ *  uniform intervals but emerge from the transition probabilities.
+ *
+ *  For each regime, the exact joint distribution of the next two years'
+ *  returns and regimes is precomputed as one alias table whose columns
+ *  hold their outcomes directly, so every two years cost 32 random bits
+ *  and one table lookup. The first year is drawn from the stationary
+ *  distribution of the chain.
+ *
+ *  Model File Format:
+ *    Key = value lines, # comments, see data/regime_model.ini:
+ *      <Regime>-next = p_expansion, p_recession, p_recovery
+ *      <Regime>-returns = return:weight, return:weight, ...
+ *
+ *  Dependencies:
+ *    - constants.h
+ *    - scenarioRng.h
+ *
+ *  Related Files:
+ *    - modelRegime.cpp
+ *    - data/regime_model.ini
+ *
+ *  Created:    October 2026
+ *  Author:     Yuping X
+ * ============================================================================
+ */
+
+#ifndef REGIME_MODEL_H_
+#define REGIME_MODEL_H_
+
+#include <array>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "constants.h"
+#include "scenarioRng.h"
+
+/* Regime-switching model used by the simulator */
+const std::string REGIME_MODEL_FILE = "data/regime_model.ini";
+
+/**
+ * @brief Market regimes, also used as indexes into the model's tables.
+ */
+enum class MarketRegime : uint32_t {
+	EXPANSION = 0,
+	RECESSION = 1,
+	RECOVERY = 2
+};
+
+/* Number of market regimes */
+const unsigned int REGIME_COUNT = 3;
+
+/* Names of the regimes in the model file, in MarketRegime order */
+const std::array<std::string, REGIME_COUNT> REGIME_NAMES = {"Expansion", "Recession", "Recovery"};
+
+/* Tolerance on the sum of a transition matrix row */
+const double REGIME_ROW_TOLERANCE = 1e-6;
+
+/* Maximum number of returns of a regime; bounds the size of the two-year
+ * tables, which grows with the square of the number of returns */
+const unsigned int REGIME_MAX_RETURNS = 16;
+
+/**
+ * @brief Markov regime-switching market model, prepared for sampling.
+ */
+class RegimeModel {
+private:
+	/* Alias table column fused with its two outcomes, each the returns of
+	 * two years and the table of the regime entered: [0] if the column
+	 * keeps its own outcome, [1] if it yields its alias. Selected rather
+	 * than branched on, as the choice is random and would mispredict */
+	struct Column {
+		uint32_t threshold;
+		uint32_t next[2];
+		float rate[2][2];
+		uint32_t padding;
+	};
+
+	/* Index of the table of the first two years, after those of the regimes */
+	static const unsigned int INITIAL_TABLE = REGIME_COUNT;
+
+	/* Two-year tables from each regime, then the table of the first two
+	 * years, back to back. All tables are padded with zero-weight columns
+	 * to the same power-of-two size, so that the column of a draw does not
+	 * depend on the regime and the only dependency from one step to the
+	 * next is the offset of the table entered, which columns store */
+	std::vector<Column> columns_;
+	unsigned int columnBits_;
+
+	/* Checksum of the model parameters, identifying the model */
+	uint64_t checksum_;
+
+public:
+	/**
+	 * @brief Loads a model file.
+	 *
+	 * @param filename Path to the model file.
+	 * @throws std::runtime_error if the file cannot be read, is malformed,
+	 *         misses a key, or a transition row does not sum to 1.
+	 */
+	explicit RegimeModel(const std::string& filename);
+
+	/**
+	 * @brief Gets the model of REGIME_MODEL_FILE, loaded on first use.
+	 *
+	 * @return The shared model.
+	 * @throws std::runtime_error if the file cannot be loaded.
+	 */
+	static const RegimeModel& shared();
+
+	/**
+	 * @brief Gets the checksum of the model parameters.
+	 *
+	 * @return The checksum.
+	 */
+	uint64_t checksum() const;
+
+	/**
+	 * @brief Generates a growth curve.
+	 *
+	 * @param growth Output array for the common (stock market) growth curve.
+	 * @param generator Random number generator to draw from.
+	 */
+	void generate(std::array<float, MAX_YEARS>& growth, ScenarioRng& generator) const;
+};
+
+/**
+ * @brief Generates a growth curve from a regime-switching model.
+ *
+ * @param growth Output array for the common (stock market) growth curve.
+ * @param generator Random number generator to draw from.
+ * @param model Regime-switching model to sample.
+ */
+void generateRegimeSwitching(std::array<float, MAX_YEARS>& growth, ScenarioRng& generator,
+                             const RegimeModel& model);
+
+#endif /* REGIME_MODEL_H_ */
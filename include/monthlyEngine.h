@@ -0,0 +1,161 @@
+/* ============================================================================
+ * monthlyEngine.h
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Declares the monthly time-step engine. By default a path is simulated a
+ *  year at a time (see Asset::calculateN()). With monthly steps, expenses
+ *  are distributed and contributions made every month, and the accounts
+ *  move within the year, which exposes the sequence risk of selling into
+ *  an intra-year drop.
+ *
+ *  The monthly engine takes the same profile and model inputs: the yearly
+ *  returns of the growth model are kept exactly, and the path of each
+ *  account within year n runs through the levels
+ *
+ *    level_k = 1 + growth_n * k / 12 + volatility * bridge_k,  k = 0 .. 12
+ *
+ *  relative to the start of the year, where bridge is a Brownian bridge
+ *  (0 at both ends, in units of a yearly standard deviation) drawn for the
+ *  market and scaled by each account's yearly volatility (the diagonal of
+ *  its return covariance, see modelCorrelated.h). The bridges do not depend
+ *  on the profile, so a scenario bank draws them once per path, after its
+ *  growth and inflation. The deterministic models have no bridge and grow
+ *  linearly within the year.
+ *
+ *  Throughput:
+ *    The engine is laid out for throughput rather than as 600 iterations
+ *    of the yearly loop. Cash flows are precomputed month by month once
+ *    per profile (MonthlySchedule), and the levels are never stored: they
+ *    are linear in each account's growth and volatility, so each year is
+ *    simulated in closed form from a few sums over its months. As every
+ *    available account gives the same share of its value to each month's
+ *    expense E_k, its value in month k is its year-start value times
+ *    level_k times a common factor Q_k with
+ *
+ *      Q_0 = 1,  Q_(k+1) = Q_k - E_k / total_k
+ *
+ *    where total_k is the sum of the available accounts' year-start
+ *    values times their levels. The expense of month k is covered as long
+ *    as the running sum of E_k / total_k stays at most 1. Only years
+ *    contributing to an account that is also distributed from are
+ *    stepped month by month.
+ *
+ *  Required minimum distributions are topped up at the end of the year,
+ *  and the tax of a year is paid in equal parts in the months of the
+ *  following year. The cash reserve and the spending rules are not
+ *  modeled with monthly steps, and profiles using them are rejected (see
+ *  simulateProfile()).
+ *
+ *  Dependencies:
+ *    - constants.h
+ *    - scenarioRng.h
+ *    - profileSchedule.h
+ *
+ *  Related Files:
+ *    - monthlyEngine.cpp
+ *    - asset.h / asset.cpp
+ *    - scenarioBank.h / scenarioBank.cpp
+ *
+ *  Created:    October 2026
+ *  Author:     Yuping X
+ * ============================================================================
+ */
+
+#ifndef MONTHLY_ENGINE_H_
+#define MONTHLY_ENGINE_H_
+
+#include <array>
+#include <cstdint>
+#include "constants.h"
+#include "scenarioRng.h"
+#include "profileSchedule.h"
+
+/**
+ * @brief Time steps of a simulation run.
+ */
+enum class StepOption : uint32_t {
+	/* One step per year */
+	ANNUAL = 0,
+
+	/* One step per month */
+	MONTHLY = 1,
+
+	MAX = MONTHLY
+};
+
+/* Number of months in a year, and over the simulated years */
+const unsigned int MONTHS_PER_YEAR = 12;
+const unsigned int MAX_MONTHS = MAX_YEARS * MONTHS_PER_YEAR;
+
+/* Largest move of a bridge off the straight line, three standard
+ * deviations of its move at mid-year */
+const float MONTHLY_BRIDGE_LIMIT = 1.5f;
+
+/* Lowest level of an account within the year, as a share of the lower end
+ * of its straight line: in the years an account's volatility could take
+ * it lower at the bridge limit, the volatility is scaled down */
+const float MONTHLY_MIN_LEVEL = 0.05f;
+
+/**
+ * @brief Brownian bridge of the market within each year of a path: the
+ *        value of month k of year n, relative to the straight line of the
+ *        year, is at index n * MONTHS_PER_YEAR + k, and 0 for k = 0.
+ */
+using MonthlyBridge = std::array<float, MAX_MONTHS>;
+
+/**
+ * @brief Generates the bridges of one path.
+ *
+ * @param bridge Output bridge of every year.
+ * @param generator Random number generator to draw from.
+ */
+void generateMonthlyBridge(MonthlyBridge& bridge, ScenarioRng& generator);
+
+/**
+ * @brief Deterministic monthly cash flows of a user profile, in the
+ *        layout the monthly engine reads them in.
+ *
+ * Built from the yearly schedule: each month of a year has a twelfth of
+ * its net expense and contributions.
+ */
+class MonthlySchedule {
+public:
+	/* Expense not covered by income and pension in each month */
+	std::array<float, MAX_MONTHS> netExpense_;
+
+	/* Contribution to each account at the end of each month */
+	std::array<std::array<float, MAX_MONTHS>, MAX_ACCOUNTS> contribution_;
+
+	/* Availability of the accounts in each year, as 1 or 0 */
+	std::array<std::array<float, MAX_ACCOUNTS>, MAX_YEARS> available_;
+
+	/* True for the years with a net expense to distribute */
+	std::array<bool, MAX_YEARS> distributes_;
+
+	/* True for the years contributing to an account that is available,
+	 * which are simulated month by month when they also distribute */
+	std::array<bool, MAX_YEARS> contributesToAvailable_;
+
+	/* True for the years contributing to any account */
+	std::array<bool, MAX_YEARS> contributes_;
+
+	/* Starting (year-0) value of each account */
+	std::array<float, MAX_ACCOUNTS> initialValue_;
+
+	/* Pension income, required minimum distribution rate and price level
+	 * of each year (see ProfileSchedule) */
+	std::array<float, MAX_YEARS> pension_;
+	std::array<float, MAX_YEARS> rmdRate_;
+	std::array<float, MAX_YEARS> priceLevel_;
+
+	/**
+	 * @brief Builds the monthly cash flows from a yearly schedule.
+	 *
+	 * @param schedule Yearly schedule of the profile, possibly re-inflated
+	 *        with the inflation of a path.
+	 */
+	void initializeFromSchedule(const ProfileSchedule& schedule);
+};
+
+#endif /* MONTHLY_ENGINE_H_ */
@@ -0,0 +1,155 @@
+/* ============================================================================
+ * ndjsonStream.h
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Declares the NDJSON streaming pipeline: profiles are read one per line
+ *  from an input stream, validated and simulated concurrently, and one
+ *  result line per profile is written to an output stream, in input order.
+ *
+ *  Input Format:
+ *    One flat JSON object per line, e.g.
+ *      {"seq": 7, "id": "leia", "Individual": 40000, "Individual-rate": 0.06,
+ *       ..., "Cost-of-living": 80000, ...}
+ *    - seq: optional sequence number echoed in the result; defaults to the
+ *      index of the line among the non-empty input lines
+ *    - id: optional profile identifier echoed in the result
+ *    - deadline_ms: optional latency budget of the line in milliseconds,
+ *      counted from when it is read; overrides the stream's default
+ *    - every column of the household book (see householdBook.h) except
+ *      Household, as a number
+ *    Empty lines are ignored.
+ *
+ *  Output Format:
+ *    One JSON object per input line, in input order:
+ *      {"seq":7,"id":"leia","seed":...,"iterations":5000,
+ *       "longevity":[n0,...,n50],"mean":41.2,"ci95":0.12,
+ *       "predefined":39,"constant":44}
+ *    where longevity[n] counts the randomized iterations lasting n years,
+ *    and mean and ci95 estimate the mean longevity and the half width of its
+ *    95% confidence interval. iterations is less than the size of the
+ *    scenario bank if the deadline was reached first. Or
+ *      {"seq":7,"id":"leia","error":"..."}
+ *    if the line could not be parsed or the profile is out of bounds.
+ *
+ *  Dependencies:
+ *    - personalFinSim.h
+ *    - scenarioBank.h
+ *    - threadPool.h
+ *    - resultCache.h
+ *    - userDataLoading.h
+ *
+ *  Related Files:
+ *    - ndjsonStream.cpp
+ *    - householdBook.h
+ *
+ *  Created:    October 2026
+ *  Author:     Yuping X
+ * ============================================================================
+ */
+
+#ifndef NDJSON_STREAM_H_
+#define NDJSON_STREAM_H_
+
+#include <string>
+#include <string_view>
+#include <istream>
+#include <ostream>
+#include <cstdint>
+#include "personalFinSim.h"
+#include "scenarioBank.h"
+#include "threadPool.h"
+#include "resultCache.h"
+#include "userDataLoading.h"
+
+/* Key of the sequence number of a line */
+const std::string NDJSON_SEQ_KEY = "seq";
+
+/* Key of the profile identifier of a line */
+const std::string NDJSON_ID_KEY = "id";
+
+/* Key of the latency budget of a line */
+const std::string NDJSON_DEADLINE_KEY = "deadline_ms";
+
+/* Default number of profiles in flight per worker thread */
+const size_t NDJSON_IN_FLIGHT_PER_WORKER = 8;
+
+/**
+ * @brief Request fields of a line besides the profile.
+ */
+struct StreamRequest {
+	/* Sequence number, if the line has one */
+	bool hasSeq = false;
+	uint64_t seq = 0;
+
+	/* Latency budget in milliseconds; 0 if the line has none */
+	unsigned int deadlineMs = 0;
+};
+
+/**
+ * @brief Options of a streaming run.
+ */
+struct StreamOptions {
+	/* Maximum number of lines in flight; 0 uses NDJSON_IN_FLIGHT_PER_WORKER
+	 * per worker of the pool */
+	size_t maxInFlight = 0;
+
+	/* Cache of results to reuse; nullptr simulates every line */
+	ResultCache* cache = nullptr;
+
+	/* Latency budget of lines without their own, in milliseconds; 0 runs
+	 * all iterations */
+	unsigned int deadlineMs = 0;
+};
+
+/**
+ * @brief Counts of a streaming run.
+ */
+struct StreamStats {
+	/* Number of non-empty input lines */
+	size_t lines = 0;
+
+	/* Number of lines answered with an error */
+	size_t errors = 0;
+};
+
+/**
+ * @brief Parses one NDJSON line into a profile.
+ *
+ * @param line Text of the line.
+ * @param user UserData struct to populate.
+ * @param request Set to the line's other request fields.
+ * @throws std::runtime_error if the line is not a flat JSON object, has an
+ *         unknown or duplicate key, a malformed value, or misses a key.
+ */
+void parseProfileJson(std::string_view line, UserData& user, StreamRequest& request);
+
+/**
+ * @brief Formats the results of a profile as one NDJSON line, without the
+ *        line ending.
+ *
+ * @param seq Sequence number of the profile.
+ * @param result Results of the profile.
+ * @return The JSON object.
+ */
+std::string formatResultJson(uint64_t seq, const SimResult& result);
+
+/**
+ * @brief Streams profiles from in to results on out.
+ *
+ * Lines are simulated on the pool with at most options.maxInFlight of them
+ * read but not yet written. Reading stops while the window is full, so a slow reader
+ * of out slows down the producer of in rather than growing a backlog. The
+ * output is flushed whenever the next result is not ready yet.
+ *
+ * @param in Input stream of profiles.
+ * @param out Output stream of results.
+ * @param bank Randomized growth curves, shared by all profiles.
+ * @param pool Thread pool to simulate on.
+ * @param options Options of the run.
+ * @return The counts of the run.
+ */
+StreamStats runNdjsonStream(std::istream& in, std::ostream& out, const ScenarioBank& bank,
+                            ThreadPool& pool, const StreamOptions& options = StreamOptions());
+
+#endif /* NDJSON_STREAM_H_ */
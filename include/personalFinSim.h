@@ -0,0 +1,240 @@
+/* ============================================================================
+ * personalFinSim.h
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Declares the simulation driver interface: simulating one or many user
+ *  profiles across all supported models, and displaying the results.
+ *
+ *  Dependencies:
+ *    - constants.h
+ *    - userDataLoading.h
+ *    - scenarioBank.h
+ *    - threadPool.h
+ *
+ *  Related Files:
+ *    - personalFinSim.cpp
+ *
+ *  Created:    October 2026
+ *  Author:     Yuping X
+ * ============================================================================
+ */
+
+#ifndef PERSONAL_FIN_SIM_H_
+#define PERSONAL_FIN_SIM_H_
+
+#include <array>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <chrono>
+#include "constants.h"
+#include "userDataLoading.h"
+#include "scenarioBank.h"
+#include "threadPool.h"
+
+/**
+ * @brief Number of bins the randomized results are grouped into.
+ *
+ * The last bin holds all runs lasting at least (RESULT_BINS_COUNT - 1) *
+ * RESULT_BINS_WIDTH years.
+ */
+const unsigned int RESULT_BINS_COUNT = MAX_YEARS / RESULT_BINS_WIDTH + 1;
+
+/**
+ * @brief Clock of simulation deadlines.
+ */
+using SimClock = std::chrono::steady_clock;
+
+/**
+ * @brief Deadline of a simulation that runs all iterations.
+ */
+const SimClock::time_point NO_DEADLINE = SimClock::time_point::max();
+
+/**
+ * @brief Number of randomized iterations run before the first deadline
+ *        check, and the most run between two checks.
+ *
+ * Chunks double from the first size up to the maximum, but are shrunk to
+ * what the measured speed fits in the time left, so a simulation never
+ * overruns its deadline by more than one chunk.
+ */
+const unsigned int ANYTIME_FIRST_CHUNK = 64;
+const unsigned int ANYTIME_MAX_CHUNK = 1024;
+
+/**
+ * @brief Results of simulating one profile across all models.
+ */
+struct SimResult {
+    /**
+     * @brief Identifier of the simulated profile.
+     */
+    std::string profileId;
+
+    /**
+     * @brief Seed of the randomized model run.
+     */
+    uint64_t seed;
+
+    /**
+     * @brief Randomized model run.
+     */
+    ModelOption model;
+
+    /**
+     * @brief Inflation model of the randomized model run.
+     */
+    InflationOption inflation;
+
+    /**
+     * @brief Tax model of all model runs.
+     */
+    TaxOption tax;
+
+    /**
+     * @brief Time step of all model runs.
+     */
+    StepOption step;
+
+    /**
+     * @brief Mortality model of the randomized model run.
+     */
+    MortalityOption mortality;
+
+    /**
+     * @brief Number of randomized model iterations run. Less than the size
+     *        of the scenario bank if the deadline was reached first.
+     */
+    unsigned int iterations;
+
+    /**
+     * @brief True if the deadline stopped the randomized model early.
+     */
+    bool deadlineReached;
+
+    /**
+     * @brief Randomized model: number of iterations whose funds lasted
+     *        exactly n years, for n in [0, MAX_YEARS]. With the mortality
+     *        model, the funds of the iterations counted at MAX_YEARS lasted
+     *        the owner's lifetime.
+     */
+    std::array<unsigned int, MAX_YEARS + 1> longevityCounts;
+
+    /**
+     * @brief Fund longevity under the predefined year-0 loss model.
+     */
+    int predefinedLongevity;
+
+    /**
+     * @brief Fund longevity under the constant growth model.
+     */
+    int constantLongevity;
+};
+
+/**
+ * @brief Estimate of the mean fund longevity of the randomized model.
+ */
+struct LongevityEstimate {
+    /**
+     * @brief Mean fund longevity in years.
+     */
+    double mean;
+
+    /**
+     * @brief Half width of the 95% confidence interval of the mean.
+     */
+    double halfWidth95;
+};
+
+/**
+ * @brief Simulates a profile across all models.
+ *
+ * The deterministic models are always run. The randomized model runs the
+ * scenarios of the bank in order, in chunks (see ANYTIME_FIRST_CHUNK),
+ * until all are done or the deadline is reached. If the deadline has
+ * passed before the first chunk, e.g. for a profile late in a batch, only
+ * the deterministic results are returned.
+ *
+ * @param user User financial profile to simulate.
+ * @param bank Randomized growth curves to use, shared across profiles.
+ * @param deadline Time by which to return the best estimate so far.
+ * @return The results of all models.
+ * @throws std::runtime_error if the profile has a spending rule or a cash
+ *         reserve and the bank has monthly steps, which do not model them.
+ */
+SimResult simulateProfile(const UserData& user, const ScenarioBank& bank,
+                          SimClock::time_point deadline = NO_DEADLINE);
+
+/**
+ * @brief Simulates the randomized model of a profile on the scenarios
+ *        [begin, end) of a bank, adding to the counts of a result.
+ *
+ * Used to split long runs into blocks; the counts of the blocks of a run
+ * add up to those of the whole run.
+ *
+ * @param user User financial profile to simulate.
+ * @param bank Randomized growth curves to use.
+ * @param begin First scenario of the bank to run.
+ * @param end One past the last scenario of the bank to run.
+ * @param result Results to add to.
+ * @throws std::runtime_error as simulateProfile().
+ */
+void simulateScenarios(const UserData& user, const ScenarioBank& bank, size_t begin, size_t end,
+                       SimResult& result);
+
+/**
+ * @brief Adds the randomized model counts of a partial result of the same
+ *        profile and seed to another.
+ *
+ * @param total Results to add to.
+ * @param part Results to add.
+ */
+void mergeSimResult(SimResult& total, const SimResult& part);
+
+/**
+ * @brief Estimates the mean fund longevity of the randomized model and its
+ *        95% confidence interval from the iterations run so far.
+ *
+ * @param result Results of a profile.
+ * @return The estimate.
+ */
+LongevityEstimate estimateLongevity(const SimResult& result);
+
+/**
+ * @brief Simulates many profiles concurrently.
+ *
+ * @param profiles User financial profiles to simulate.
+ * @param bank Randomized growth curves to use, shared across profiles.
+ * @param pool Thread pool to run the simulations on.
+ * @param deadline Time by which every profile returns its best estimate.
+ * @return The results, in the order of profiles.
+ * @throws std::runtime_error as simulateProfile().
+ */
+std::vector<SimResult> simulateProfiles(const std::vector<UserData>& profiles,
+                                        const ScenarioBank& bank, ThreadPool& pool,
+                                        SimClock::time_point deadline = NO_DEADLINE);
+
+/**
+ * @brief Prints the results of all models to stdout.
+ *
+ * @param result Results of a profile.
+ */
+void displaySimResult(const SimResult& result);
+
+/**
+ * @brief Prints the results of many profiles to stdout, each under a
+ *        header naming its profile.
+ *
+ * @param results Results of the profiles.
+ */
+void displaySimResults(const std::vector<SimResult>& results);
+
+/**
+ * @brief Runs all simulation models on the given user profile and prints
+ *        the results, using a freshly seeded scenario bank.
+ *
+ * @param user User financial profile used to run the simulations.
+ */
+void runSimAll(const UserData& user);
+
+#endif /* PERSONAL_FIN_SIM_H_ */
@@ -0,0 +1,177 @@
+/* ============================================================================
+ * profileBinary.h
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Declares the compiled binary profile format and the function interface
+ *  for writing and loading it. A compiled file holds any number of
+ *  validated profiles as fixed-layout little-endian records, so it can be
+ *  memory-mapped and used without parsing.
+ *
+ *  File Layout:
+ *    - ProfileBinaryHeader (32 bytes): magic "PFSB", format version, record
+ *      size, record count and a 64-bit FNV-1a checksum of all records.
+ *    - recordCount ProfileRecord entries.
+ *
+ *  Dependencies:
+ *    - constants.h
+ *    - userDataLoading.h
+ *    - mappedFile.h
+ *
+ *  Related Files:
+ *    - profileBinary.cpp
+ *
+ *  Created:    October 2026
+ *  Author:     Yuping X
+ * ============================================================================
+ */
+
+#ifndef PROFILE_BINARY_H_
+#define PROFILE_BINARY_H_
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "constants.h"
+#include "userDataLoading.h"
+#include "mappedFile.h"
+
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__)
+#error "The compiled profile format is little-endian and is mapped without conversion"
+#endif
+
+/* Default file extension of compiled profiles */
+const std::string PROFILE_BINARY_FILE_ENDING = ".pfsb";
+
+/* Magic number at the start of every compiled file */
+const char PROFILE_BINARY_MAGIC[4] = {'P', 'F', 'S', 'B'};
+
+/* Format version; increment whenever ProfileRecord changes */
+const uint16_t PROFILE_BINARY_VERSION = 2;
+
+/* Size of the fixed-length, zero-padded name fields (including the
+ * terminating zero) */
+const unsigned int PROFILE_BINARY_NAME_SIZE = 32;
+
+/**
+ * @brief Header at the start of a compiled profile file.
+ */
+struct ProfileBinaryHeader {
+    char magic[4];
+    uint16_t version;
+    uint16_t recordSize;
+    uint32_t reserved;
+    uint32_t reserved2;
+    uint64_t recordCount;
+    uint64_t checksum;
+};
+
+/**
+ * @brief Fixed-layout record of one profile. Mirrors UserData.
+ */
+struct ProfileRecord {
+    char profileId[PROFILE_BINARY_NAME_SIZE];
+    char name[MAX_ACCOUNTS][PROFILE_BINARY_NAME_SIZE];
+    int32_t value[MAX_ACCOUNTS];
+    float rate[MAX_ACCOUNTS];
+    int32_t initialExpense;
+    int32_t takehomeIncome;
+    int32_t contributionRoth;
+    int32_t contributionIra;
+    int32_t contributionR401k;
+    int32_t pensionEstimate;
+    float initialInflation;
+    uint16_t yearsTillRetirement;
+    uint16_t yearsTillWithdrawal;
+    uint16_t yearsTillPension;
+    uint16_t birthYear;
+    float covariance[MAX_ACCOUNTS][MAX_ACCOUNTS];
+    int32_t eventExpense[MAX_YEARS];
+    float cashReserveYears;
+    float cashReserveRefill;
+    uint16_t sex;
+    uint16_t spendingRule;
+};
+
+static_assert(sizeof(ProfileBinaryHeader) == 32, "Unexpected compiled header layout");
+static_assert(sizeof(ProfileRecord) == 504, "Unexpected compiled record layout");
+
+/**
+ * @brief Converts a profile to its fixed-layout record.
+ *
+ * @param user Profile to convert.
+ * @param record Record to populate; unused bytes are zeroed.
+ * @throws std::runtime_error if a name does not fit in its field.
+ */
+void recordFromUserData(const UserData& user, ProfileRecord& record);
+
+/**
+ * @brief Converts a fixed-layout record back to a profile.
+ *
+ * @param record Record to convert.
+ * @param user UserData struct to populate.
+ */
+void userDataFromRecord(const ProfileRecord& record, UserData& user);
+
+/**
+ * @brief Writes validated profiles to a compiled file.
+ *
+ * @param filename Path to the output file.
+ * @param profiles Profiles to write; each must pass userDataWithinBounds().
+ * @throws std::runtime_error if a profile is invalid or the file cannot be written.
+ */
+void writeCompiledProfiles(const std::string& filename, const std::vector<UserData>& profiles);
+
+/**
+ * @brief Read-only view of a memory-mapped compiled profile file.
+ *
+ * The header and checksum are verified when the file is opened; records
+ * are then accessed in place.
+ */
+class CompiledProfiles {
+private:
+    /* The mapped file */
+    MappedFile file_;
+
+    /* First record in the mapping */
+    const ProfileRecord* records_;
+
+    /* Number of records */
+    size_t count_;
+
+public:
+    /**
+     * @brief Maps and verifies a compiled profile file.
+     *
+     * @param filename Path to the compiled file.
+     * @throws std::runtime_error on a bad magic number, version, size or checksum.
+     */
+    explicit CompiledProfiles(const std::string& filename);
+
+    /**
+     * @brief Gets the number of profiles in the file.
+     *
+     * @return The record count.
+     */
+    size_t size() const;
+
+    /**
+     * @brief Gets a record.
+     *
+     * @param index Index of the record, less than size().
+     * @return Reference to the mapped record.
+     */
+    const ProfileRecord& operator[](size_t index) const;
+};
+
+/**
+ * @brief Computes the 64-bit FNV-1a checksum of a byte range.
+ *
+ * @param data Start of the bytes.
+ * @param size Number of bytes.
+ * @return The checksum.
+ */
+uint64_t profileChecksum(const void* data, size_t size);
+
+#endif /* PROFILE_BINARY_H_ */
@@ -0,0 +1,219 @@
+/* ============================================================================
+ * profileSchedule.h
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Declares the ProfileSchedule class, which holds every per-year quantity of
+ *  a simulation that does not depend on the market growth curve: inflated
+ *  expenses, job income, pension income, account contributions and the
+ *  availability mask of each account.
+ *
+ *  These quantities are identical across all iterations of a randomized
+ *  simulation, so the schedule is built once per profile and then combined
+ *  with a different growth curve in each iteration by Asset::calculateN().
+ *  With stochastic inflation, a copy of the schedule is re-inflated with
+ *  each iteration's inflation curve instead (see inflate()). The required
+ *  minimum distributions of the tax-deferred accounts are also set here,
+ *  as the fraction of their balance to distribute in each year.
+ *
+ *  Life events (the [Events] profile section) arrive already compiled into
+ *  one expense per year (UserData::eventExpense), which is added to the
+ *  expense of every year in one pass when the schedule is built, so the
+ *  events cost nothing per path.
+ *
+ *  Dependencies:
+ *    - constants.h
+ *    - userDataLoading.h
+ *    - modelInflation.h
+ *    - rmdTable.h
+ *    - spendingPolicy.h
+ *
+ *  Related Files:
+ *    - profileSchedule.cpp
+ *    - asset.h / asset.cpp
+ *
+ *  Created:    October 2026
+ *  Author:     Yuping X
+ * ============================================================================
+ */
+
+#ifndef PROFILE_SCHEDULE_H_
+#define PROFILE_SCHEDULE_H_
+
+#include <array>
+#include "constants.h"
+#include "userDataLoading.h"
+#include "modelInflation.h"
+#include "spendingPolicy.h"
+
+class Asset;
+
+/**
+ * @brief Deterministic per-year cash flows of a user profile.
+ *
+ * All monetary amounts are nominal (inflated) dollars of the given year and
+ * follow the same per-year truncation as the original year-by-year update,
+ * so simulating with a schedule gives the same results as before.
+ */
+class ProfileSchedule {
+public:
+	/* Starting (year-0) value of each account */
+	std::array<long int, MAX_ACCOUNTS> initialValue_;
+
+	/* Gross expense by year, life events included */
+	std::array<long int, MAX_YEARS> expense_;
+
+	/* Take-home job income by year (0 from the retirement year on) */
+	std::array<long int, MAX_YEARS> income_;
+
+	/* Pension income by year (0 before the pension starts) */
+	std::array<long int, MAX_YEARS> pension_;
+
+	/* Expense not covered by income and pension, to be distributed from
+	 * the available accounts */
+	std::array<long int, MAX_YEARS> netExpense_;
+
+	/* 2D array of contribution added to each account at the end of each year.
+	 * The individual account receives the income surplus before retirement. */
+	std::array<std::array<long int, MAX_YEARS>, MAX_ACCOUNTS> contribution_;
+
+	/* 2D array to indicate availability for funds in each year */
+	std::array<std::array<bool, MAX_YEARS>, MAX_ACCOUNTS> availability_;
+
+	/* Inflation rate vector by year */
+	std::array<float, MAX_YEARS> inflation_;
+
+	/* Price level of each year relative to year 0: the product of
+	 * (1 + inflation) over the years before it */
+	std::array<float, MAX_YEARS> priceLevel_;
+
+	/* Fraction of its balance each tax-deferred account must distribute
+	 * at least in each year: the inverse of the owner's Uniform Lifetime
+	 * Table divisor from the RMD age on, 0 before */
+	std::array<float, MAX_YEARS> rmdRate_;
+
+	/* First year with a required distribution, MAX_YEARS if none */
+	int rmdStartYear_;
+
+	/* Cash reserve target in years of net expense (0 for none), and the
+	 * lowest return of the individual account in a year for the reserve
+	 * to be refilled the next year */
+	float cashReserveYears_;
+	float cashReserveRefill_;
+
+	/* Spending rule of the withdrawals from retirement on */
+	SpendingRule spendingRule_;
+
+	/* Number of years before reaching retirement (i.e. job income stops) */
+	int yearsTillRetirement_;
+
+	/* True if job and pension income cover the expense in every year before
+	 * retirement, i.e. nothing is distributed during the accumulation phase
+	 * and it can be fast-forwarded in closed form. */
+	bool accumulationFastPath_;
+
+private:
+	/* Year-0 amounts and profile inflation the cash flows were filled
+	 * from, kept to re-inflate them */
+	long int baseExpense_;
+	long int baseIncome_;
+	long int baseRoth_;
+	long int baseIra_;
+	long int baseR401k_;
+	int basePension_;
+	int yearsTillPension_;
+	std::array<float, MAX_YEARS> baseInflation_;
+
+	/* Product of (1 + base inflation) over the years before each year */
+	std::array<float, MAX_YEARS> baseGrowth_;
+
+	/* Life-event expense of each year in year-0 dollars */
+	std::array<float, MAX_YEARS> baseEvents_;
+
+	/* Net expense of each year in year-0 dollars (negative for a surplus) */
+	std::array<float, MAX_YEARS> baseNetExpense_;
+
+	/* Largest year-0 amount */
+	float largestAmount_;
+
+public:
+	/**
+	 * @brief Builds the schedule from a user profile.
+	 *
+	 * @param user Reference to a UserData object containing user financial parameters.
+	 */
+	void initializeFromUserData(const UserData& user);
+
+	/**
+	 * @brief Builds the schedule from the current state of an Asset.
+	 *
+	 * Uses the Asset's year-0 values, current income, contributions, pension,
+	 * per-year inflation and availability. This is used when an Asset has
+	 * been set up member by member rather than from a UserData profile.
+	 * No distribution is required, as an Asset has no birth year, and no
+	 * cash is held apart.
+	 *
+	 * @param asset Asset whose data members describe the profile.
+	 */
+	void initializeFromAsset(const Asset& asset);
+
+	/**
+	 * @brief Refills the cash flows with the inflation of a path.
+	 *
+	 * The inflation of each year becomes the one the schedule was built
+	 * with, compounded with the path's deviation. Amounts are truncated to
+	 * the dollar once rather than year by year, so a zero deviation gives
+	 * back the schedule as built only up to the truncations it compounds
+	 * (a few hundredths of a percent).
+	 *
+	 * @param path Inflation deviations of the path.
+	 */
+	void inflate(const InflationPath& path);
+
+	/**
+	 * @brief Default constructor. Sets all data members to zero.
+	 */
+	ProfileSchedule();
+
+private:
+	/**
+	 * @brief Fills the per-year cash flows from year-0 amounts.
+	 *
+	 * availability_ and initialValue_ must be set by the caller.
+	 */
+	void fillCashFlows(long int expense, long int income, long int roth,
+	                   long int ira, long int r401k, int pension,
+	                   int yearsTillRetirement, int yearsTillPension,
+	                   const std::array<float, MAX_YEARS>& inflation);
+
+	/**
+	 * @brief Fills rmdRate_ and rmdStartYear_ from the owner's birth year,
+	 *        and makes the tax-deferred accounts available from the first
+	 *        required distribution on.
+	 *
+	 * @param birthYear Owner's birth year, 0 if no distribution is required.
+	 */
+	void fillRequiredDistributions(int birthYear);
+
+	/**
+	 * @brief Adds the life-event expense of each year, inflated, to the
+	 *        expense, net expense and income surplus filled from the
+	 *        year-0 amounts, once prepareInflation() has run.
+	 */
+	void applyEvents();
+
+	/**
+	 * @brief Fills baseGrowth_, baseNetExpense_ and largestAmount_ from
+	 *        the year-0 amounts, once the cash flows are filled.
+	 */
+	void prepareInflation();
+
+	/**
+	 * @brief Fills the cash flows from the cumulative inflation of each
+	 *        year, truncating amounts through the Dollars integer type.
+	 */
+	template <typename Dollars>
+	void inflateAmounts(const std::array<float, MAX_YEARS>& factor);
+};
+
+#endif /* PROFILE_SCHEDULE_H_ */
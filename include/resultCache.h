@@ -0,0 +1,196 @@
+/* ============================================================================
+ * resultCache.h
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Declares the ResultCache class, an in-memory, least-recently-used cache
+ *  of simulation results shared by all requests of a streaming run or of
+ *  the simulation daemon.
+ *
+ *  Results are keyed by the canonical form of a profile: its compiled
+ *  record (see profileBinary.h) with the profile and account names blanked,
+ *  plus the seed and size of the scenario bank and a hash of the model
+ *  constants. Two requests with the same key get bit-identical results, so
+ *  a hit returns the stored result with only the profile id replaced.
+ *
+ *  Dependencies:
+ *    - personalFinSim.h
+ *    - profileBinary.h
+ *    - scenarioBank.h
+ *
+ *  Related Files:
+ *    - resultCache.cpp
+ *
+ *  Created:    October 2026
+ *  Author:     Yuping X
+ * ============================================================================
+ */
+
+#ifndef RESULT_CACHE_H_
+#define RESULT_CACHE_H_
+
+#include <cstdint>
+#include <cstddef>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include "personalFinSim.h"
+#include "profileBinary.h"
+#include "scenarioBank.h"
+
+/* Default memory bound of the cache, in megabytes */
+const size_t RESULT_CACHE_DEFAULT_MB = 64;
+
+/* Version of the simulation models; increment whenever a change to the
+ * simulation code changes its results, so that no stale result is reused */
+const uint32_t SIM_MODEL_VERSION = 1;
+
+/**
+ * @brief Canonical cache key of a profile simulated against a bank.
+ */
+struct CacheKey {
+	ProfileRecord record;
+	uint32_t iterations;
+	uint32_t reserved;
+	uint64_t seed;
+	uint64_t modelHash;
+
+	bool operator==(const CacheKey& other) const;
+};
+
+static_assert(sizeof(CacheKey) == sizeof(ProfileRecord) + 24, "CacheKey must not have padding");
+
+/**
+ * @brief Hashes a CacheKey with 64-bit FNV-1a.
+ */
+struct CacheKeyHash {
+	size_t operator()(const CacheKey& key) const;
+};
+
+/**
+ * @brief Counters of a ResultCache.
+ */
+struct CacheStats {
+	uint64_t hits = 0;
+	uint64_t misses = 0;
+	uint64_t evictions = 0;
+	size_t entries = 0;
+	size_t bytes = 0;
+};
+
+/**
+ * @brief Hashes the simulation model version and constants.
+ *
+ * @return The hash, which changes whenever a model constant changes.
+ */
+uint64_t modelConstantsHash();
+
+/**
+ * @brief Hashes everything the results of a randomized model depend on
+ *        besides the profile and the seed: the model constants, the model
+ *        itself and its data (returns table or regime model), the
+ *        inflation model, the tax model and its brackets, the time step, and
+ *        the mortality model and its life table.
+ *
+ * @param model The randomized model.
+ * @param inflation The inflation model.
+ * @param tax The tax model.
+ * @param step The time step.
+ * @param mortality The mortality model.
+ * @return The hash.
+ */
+uint64_t scenarioModelHash(ModelOption model, InflationOption inflation = InflationOption::CONSTANT,
+                           TaxOption tax = TaxOption::NONE, StepOption step = StepOption::ANNUAL,
+                           MortalityOption mortality = MortalityOption::NONE);
+
+/**
+ * @brief Converts a profile to its canonical record: the compiled record
+ *        with the profile and account names blanked, as names do not
+ *        affect the results.
+ *
+ * @param user Profile to convert.
+ * @param record Record to populate.
+ */
+void canonicalRecord(const UserData& user, ProfileRecord& record);
+
+/**
+ * @brief Builds the canonical cache key of a profile simulated against a bank.
+ *
+ * @param user Profile to simulate.
+ * @param bank Scenario bank of the simulation.
+ * @return The key.
+ */
+CacheKey makeCacheKey(const UserData& user, const ScenarioBank& bank);
+
+/**
+ * @brief Thread-safe LRU cache of simulation results, bounded by memory.
+ */
+class ResultCache {
+private:
+	/* Cached results, most recently used first */
+	std::list<std::pair<CacheKey, SimResult>> entries_;
+
+	/* Index of the entries by key */
+	std::unordered_map<CacheKey, std::list<std::pair<CacheKey, SimResult>>::iterator, CacheKeyHash> index_;
+
+	/* Memory bound in bytes */
+	size_t maxBytes_;
+
+	CacheStats stats_;
+	mutable std::mutex mutex_;
+
+public:
+	/**
+	 * @brief Approximate memory used by one entry, including its index.
+	 */
+	static const size_t ENTRY_BYTES;
+
+	/**
+	 * @brief Creates an empty cache.
+	 *
+	 * @param maxBytes Memory bound in bytes; 0 disables caching.
+	 */
+	explicit ResultCache(size_t maxBytes);
+
+	/**
+	 * @brief Looks up a result and marks it as recently used.
+	 *
+	 * @param key Key of the result.
+	 * @param result Set to the cached result on a hit.
+	 * @return true on a hit.
+	 */
+	bool lookup(const CacheKey& key, SimResult& result);
+
+	/**
+	 * @brief Stores a result, evicting the least recently used results as
+	 * needed to stay within the memory bound.
+	 *
+	 * @param key Key of the result.
+	 * @param result Result to store.
+	 */
+	void insert(const CacheKey& key, const SimResult& result);
+
+	/**
+	 * @brief Gets the counters of the cache.
+	 *
+	 * @return A snapshot of the counters.
+	 */
+	CacheStats stats() const;
+};
+
+/**
+ * @brief Simulates a profile, reusing a cached result when possible.
+ *
+ * Only complete results are cached; a result cut short by its deadline is
+ * returned but not stored.
+ *
+ * @param user User financial profile to simulate.
+ * @param bank Randomized growth curves to use.
+ * @param cache Cache to use; nullptr simulates without caching.
+ * @param deadline Time by which to return the best estimate so far.
+ * @return The results of all models.
+ */
+SimResult simulateProfileCached(const UserData& user, const ScenarioBank& bank, ResultCache* cache,
+                                SimClock::time_point deadline = NO_DEADLINE);
+
+#endif /* RESULT_CACHE_H_ */
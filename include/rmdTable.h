@@ -0,0 +1,54 @@
+/* ============================================================================
+ * rmdTable.h
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Declares the required minimum distribution (RMD) rules of the
+ *  tax-deferred IRA and 401k accounts. From the year its owner reaches the
+ *  RMD age, each of these accounts must distribute at least its balance at
+ *  the end of the previous year divided by the divisor of the owner's age
+ *  in the IRS Uniform Lifetime Table.
+ *
+ *  The RMD age depends on the owner's birth year (SECURE 2.0 Act): 72 up to
+ *  1950, 73 from 1951 to 1959, and 75 from 1960 on. The divisors are a
+ *  table by age, from RMD_FIRST_AGE to RMD_LAST_AGE, the last applying to
+ *  every later age.
+ *
+ *  ProfileSchedule turns these into the fraction required in each
+ *  simulated year when a profile is loaded, so the simulation itself only
+ *  looks up the fraction of the year and multiplies it with the balance
+ *  (see ProfileSchedule::rmdRate_).
+ *
+ *  Related Files:
+ *    - rmdTable.cpp
+ *    - profileSchedule.h / profileSchedule.cpp
+ *
+ *  Created:    October 2026
+ *  Author:     Yuping X
+ * ============================================================================
+ */
+
+#ifndef RMD_TABLE_H_
+#define RMD_TABLE_H_
+
+/* Ages of the first and last divisors of the Uniform Lifetime Table */
+const int RMD_FIRST_AGE = 72;
+const int RMD_LAST_AGE = 120;
+
+/**
+ * @brief Gets the age of the first required distribution.
+ *
+ * @param birthYear Owner's birth year.
+ * @return The RMD age, at least RMD_FIRST_AGE.
+ */
+int rmdStartAge(int birthYear);
+
+/**
+ * @brief Gets the Uniform Lifetime Table divisor of an age.
+ *
+ * @param age Owner's age in the distribution year, at least RMD_FIRST_AGE.
+ * @return The divisor; the one of RMD_LAST_AGE beyond it.
+ */
+float rmdDivisor(int age);
+
+#endif /* RMD_TABLE_H_ */
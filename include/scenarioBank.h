@@ -0,0 +1,262 @@
+/* ============================================================================
+ * scenarioBank.h
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Declares the ScenarioBank class, which holds the common (stock market)
+ *  growth curves of all iterations of a randomized simulation run.
+ *
+ *  The randomized models do not depend on the user profile, so one bank is
+ *  generated per run and shared by every profile simulated in it. Scenario
+ *  i is generated from ScenarioRng(seed, i), so a bank is fully determined
+ *  by its model, seed and size.
+ *
+ *  The correlated per-account model has no common curve; its bank holds
+ *  the unit draws of every account instead, which each profile turns into
+ *  returns with its own covariance factor (see modelCorrelated.h).
+ *
+ *  With stochastic inflation, the bank also holds each iteration's
+ *  deviations from the profiles' inflation rate (see modelInflation.h).
+ *  The bank also carries the tax model every profile of the run is
+ *  simulated with (see taxModel.h), and its time step: with monthly steps,
+ *  the bank also holds each iteration's intra-year bridges (see
+ *  monthlyEngine.h). With the life-table mortality model, it holds the
+ *  random bits each iteration draws its death years from (see
+ *  modelMortality.h).
+ *
+ *  Dependencies:
+ *    - constants.h
+ *    - scenarioRng.h
+ *    - threadPool.h
+ *    - modelMortality.h
+ *
+ *  Related Files:
+ *    - scenarioBank.cpp
+ *    - modelRecession.h / modelRecession.cpp
+ *    - modelHistorical.h / modelHistorical.cpp
+ *    - modelRegime.h / modelRegime.cpp
+ *    - modelCorrelated.h / modelCorrelated.cpp
+ *    - modelInflation.h / modelInflation.cpp
+ *    - taxModel.h / taxModel.cpp
+ *    - monthlyEngine.h / monthlyEngine.cpp
+ *
+ *  Created:    October 2026
+ *  Author:     Yuping X
+ * ============================================================================
+ */
+
+#ifndef SCENARIO_BANK_H_
+#define SCENARIO_BANK_H_
+
+#include <array>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include "constants.h"
+#include "threadPool.h"
+#include "modelRecession.h"
+#include "modelCorrelated.h"
+#include "modelInflation.h"
+#include "taxModel.h"
+#include "monthlyEngine.h"
+#include "modelMortality.h"
+
+/**
+ * @brief Shared, seeded set of randomized common growth curves.
+ */
+class ScenarioBank {
+private:
+	/* Seed of the run */
+	uint64_t seed_;
+
+	/* Iteration index of the first scenario */
+	uint64_t first_;
+
+	/* Randomized model the curves are drawn from */
+	ModelOption model_;
+
+	/* Inflation model of the iterations */
+	InflationOption inflation_;
+
+	/* Tax model the profiles are simulated with */
+	TaxOption tax_;
+
+	/* Time step the profiles are simulated with */
+	StepOption step_;
+
+	/* Mortality model of the iterations */
+	MortalityOption mortality_;
+
+	/* Number of scenarios */
+	size_t size_;
+
+	/* Common growth curve of each iteration */
+	std::vector<std::array<float, MAX_YEARS>> curves_;
+
+	/* Unit draws of each iteration, for the correlated per-account model */
+	std::vector<AccountDraws> draws_;
+
+	/* Inflation deviations of each iteration, for stochastic inflation */
+	std::vector<InflationPath> inflationPaths_;
+
+	/* Intra-year bridges of each iteration, for monthly steps */
+	std::vector<MonthlyBridge> bridges_;
+
+	/* Random bits of the death year of each iteration, for the mortality
+	 * model */
+	std::vector<uint32_t> deathDraws_;
+
+public:
+	/**
+	 * @brief Generates the growth curves of a run.
+	 *
+	 * @param seed Seed of the run.
+	 * @param iterations Number of scenarios to generate.
+	 * @param pool Optional thread pool to generate the scenarios on.
+	 * @param model Randomized model to draw the curves from.
+	 * @param inflation Inflation model of the iterations.
+	 * @param tax Tax model the profiles are simulated with.
+	 * @param step Time step the profiles are simulated with.
+	 * @param mortality Mortality model of the iterations.
+	 * @throws std::runtime_error if the model's data cannot be loaded.
+	 */
+	ScenarioBank(uint64_t seed, unsigned int iterations, ThreadPool* pool = nullptr,
+	             ModelOption model = ModelOption::RECESSION_RANDOMIZED,
+	             InflationOption inflation = InflationOption::CONSTANT,
+	             TaxOption tax = TaxOption::NONE,
+	             StepOption step = StepOption::ANNUAL,
+	             MortalityOption mortality = MortalityOption::NONE);
+
+	/**
+	 * @brief Generates a block of the growth curves of a run: scenario k of
+	 * the bank is the one of iteration first + k. Used by runs too long to
+	 * hold all their scenarios at once.
+	 *
+	 * @param seed Seed of the run.
+	 * @param first Iteration index of the first scenario.
+	 * @param iterations Number of scenarios to generate.
+	 * @param pool Optional thread pool to generate the scenarios on.
+	 * @param model Randomized model to draw the curves from.
+	 * @param inflation Inflation model of the iterations.
+	 * @param tax Tax model the profiles are simulated with.
+	 * @param step Time step the profiles are simulated with.
+	 * @param mortality Mortality model of the iterations.
+	 * @throws std::runtime_error if the model's data cannot be loaded.
+	 */
+	ScenarioBank(uint64_t seed, uint64_t first, unsigned int iterations, ThreadPool* pool = nullptr,
+	             ModelOption model = ModelOption::RECESSION_RANDOMIZED,
+	             InflationOption inflation = InflationOption::CONSTANT,
+	             TaxOption tax = TaxOption::NONE,
+	             StepOption step = StepOption::ANNUAL,
+	             MortalityOption mortality = MortalityOption::NONE);
+
+	/**
+	 * @brief Gets the seed the bank was generated from.
+	 *
+	 * @return The seed of the run.
+	 */
+	uint64_t seed() const;
+
+	/**
+	 * @brief Gets the randomized model the curves are drawn from.
+	 *
+	 * @return The model.
+	 */
+	ModelOption model() const;
+
+	/**
+	 * @brief Gets the inflation model of the iterations.
+	 *
+	 * @return The inflation model.
+	 */
+	InflationOption inflation() const;
+
+	/**
+	 * @brief Gets the tax model the profiles are simulated with.
+	 *
+	 * @return The tax model.
+	 */
+	TaxOption tax() const;
+
+	/**
+	 * @brief Gets the time step the profiles are simulated with.
+	 *
+	 * @return The time step.
+	 */
+	StepOption step() const;
+
+	/**
+	 * @brief Gets the mortality model of the iterations.
+	 *
+	 * @return The mortality model.
+	 */
+	MortalityOption mortality() const;
+
+	/**
+	 * @brief Gets the iteration index of the first scenario.
+	 *
+	 * @return The index; 0 unless the bank is a block of a longer run.
+	 */
+	uint64_t first() const;
+
+	/**
+	 * @brief Gets the number of scenarios.
+	 *
+	 * @return The number of iterations in the bank.
+	 */
+	size_t size() const;
+
+	/**
+	 * @brief Gets the common growth curve of an iteration. Not available
+	 *        for the correlated per-account model.
+	 *
+	 * @param iteration Index of the iteration, less than size().
+	 * @return The growth curve.
+	 */
+	const std::array<float, MAX_YEARS>& operator[](size_t iteration) const;
+
+	/**
+	 * @brief Gets the unit draws of an iteration of the correlated
+	 *        per-account model; those of the following iterations follow.
+	 *
+	 * @param iteration Index of the iteration, less than size().
+	 * @return The draws.
+	 */
+	const AccountDraws* draws(size_t iteration) const;
+
+	/**
+	 * @brief Gets the inflation deviations of an iteration. Only available
+	 *        with stochastic inflation.
+	 *
+	 * @param iteration Index of the iteration, less than size().
+	 * @return The deviations from the profile's inflation rate.
+	 */
+	const InflationPath& inflationPath(size_t iteration) const;
+
+	/**
+	 * @brief Gets the intra-year bridges of an iteration. Only available
+	 *        with monthly steps.
+	 *
+	 * @param iteration Index of the iteration, less than size().
+	 * @return The bridges of every year.
+	 */
+	const MonthlyBridge& monthlyBridge(size_t iteration) const;
+
+	/**
+	 * @brief Gets the random bits of the death year of an iteration. Only
+	 *        available with the life-table mortality model.
+	 *
+	 * @param iteration Index of the iteration, less than size().
+	 * @return The bits, to be passed to LifeTable::deathYear().
+	 */
+	uint32_t deathDraw(size_t iteration) const;
+};
+
+/**
+ * @brief Makes a seed from the system clock, for runs without a given seed.
+ *
+ * @return The seed.
+ */
+uint64_t clockSeed();
+
+#endif /* SCENARIO_BANK_H_ */
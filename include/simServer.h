@@ -0,0 +1,126 @@
+/* ============================================================================
+ * simServer.h
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Declares the SimServer class, the simulation daemon behind `pfsim serve`.
+ *  The server keeps one thread pool and one scenario bank resident and
+ *  answers simulation requests on a local Unix domain socket, so a request
+ *  costs only its simulation rather than a process start.
+ *
+ *  Protocol:
+ *    The NDJSON formats of ndjsonStream.h, over a stream socket: the client
+ *    writes one profile per line and reads one result line per profile, in
+ *    request order. Requests may be pipelined; a connection stays open for
+ *    as many requests as the client sends.
+ *
+ *  Dependencies:
+ *    - ndjsonStream.h
+ *    - scenarioBank.h
+ *    - threadPool.h
+ *
+ *  Related Files:
+ *    - simServer.cpp
+ *
+ *  Created:    October 2026
+ *  Author:     Yuping X
+ * ============================================================================
+ */
+
+#ifndef SIM_SERVER_H_
+#define SIM_SERVER_H_
+
+#include <string>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include "scenarioBank.h"
+#include "threadPool.h"
+#include "ndjsonStream.h"
+
+/* Socket path used when none is given */
+const std::string SERVER_DEFAULT_SOCKET = "/tmp/pfsim.sock";
+
+/* Maximum number of connections waiting to be accepted */
+const int SERVER_LISTEN_BACKLOG = 64;
+
+/**
+ * @brief Simulation daemon on a Unix domain socket.
+ */
+class SimServer {
+private:
+	/* A client connection and the thread serving it */
+	struct Session;
+
+	/* Path of the socket file */
+	std::string socketPath_;
+
+	/* Scenario bank and thread pool shared by all requests */
+	const ScenarioBank& bank_;
+	ThreadPool& pool_;
+
+	/* Options of every connection's stream, including the result cache
+	 * shared by all connections */
+	StreamOptions options_;
+
+	/* Listening socket */
+	int listenFd_;
+
+	/* Pipe written by stop() to wake up run() */
+	int wakeFd_[2];
+
+	/* Set by stop() */
+	std::atomic<bool> stopping_;
+
+	/* Open connections */
+	std::list<std::unique_ptr<Session>> sessions_;
+	std::mutex sessionsMutex_;
+
+	/**
+	 * @brief Joins the sessions whose client has disconnected.
+	 */
+	void reapSessions();
+
+public:
+	/**
+	 * @brief Creates the socket and starts listening on it. A stale socket
+	 * file at the path is replaced.
+	 *
+	 * @param socketPath Path of the socket file.
+	 * @param bank Scenario bank shared by all requests.
+	 * @param pool Thread pool shared by all requests.
+	 * @param options Options of every connection's stream; the cache, if
+	 *        any, is shared by all connections.
+	 * @throws std::runtime_error if the socket cannot be created.
+	 */
+	SimServer(const std::string& socketPath, const ScenarioBank& bank, ThreadPool& pool,
+	          const StreamOptions& options = StreamOptions());
+
+	/**
+	 * @brief Closes all connections and removes the socket file.
+	 */
+	~SimServer();
+
+	/**
+	 * @brief Accepts and serves connections until stop() is called.
+	 */
+	void run();
+
+	/**
+	 * @brief Makes run() return. Safe to call from a signal handler.
+	 */
+	void stop();
+
+	/**
+	 * @brief Copy constructor (disallowed).
+	 */
+	SimServer(const SimServer&) = delete;
+
+	/**
+	 * @brief Copy assignment operator (disallowed).
+	 */
+	SimServer& operator=(const SimServer&) = delete;
+};
+
+#endif /* SIM_SERVER_H_ */
@@ -0,0 +1,170 @@
+/* ============================================================================
+ * spendingPolicy.h
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Declares the spending rules of a profile. By default the net expense of
+ *  every year (what job and pension income leave uncovered) is withdrawn as
+ *  planned, whatever the markets did. A dynamic rule instead adjusts each
+ *  withdrawal from retirement on to the state of its path, as retirees do:
+ *
+ *    - Guardrails (Guyton-Klinger): the withdrawal rate of the first year
+ *      of retirement is kept as a reference. In later years, when the
+ *      current rate rises past the upper guardrail, spending is cut by a
+ *      step, and when it falls below the lower one, spending is raised by
+ *      a step; the adjustments carry over to the following years.
+ *    - Percent of portfolio: every year withdraws the reference rate of
+ *      what the portfolio holds, so it hardly ever runs out but spending
+ *      swings with the markets.
+ *    - Floor and ceiling: the percent-of-portfolio withdrawal, kept within
+ *      a floor and a ceiling of the planned one.
+ *
+ *  Each rule is a small policy class with per-path state, and the yearly
+ *  loop of Asset::calculateN() is a template over the policy: the profile's
+ *  rule is dispatched once per path, and each rule gets its own loop with
+ *  the adjustment inlined. The fixed rule compiles to the plain loop.
+ *
+ *  Dependencies:
+ *    - constants.h
+ *
+ *  Related Files:
+ *    - asset.h / asset.cpp
+ *    - profileSchedule.h
+ *
+ *  Created:    October 2026
+ *  Author:     Yuping X
+ * ============================================================================
+ */
+
+#ifndef SPENDING_POLICY_H_
+#define SPENDING_POLICY_H_
+
+#include <algorithm>
+#include <string_view>
+#include "constants.h"
+
+/**
+ * @brief Spending rules of a profile (UserData::spendingRule).
+ */
+enum class SpendingRule : unsigned short {
+	/* The planned net expense, indexed to inflation */
+	FIXED = 0,
+
+	/* Guyton-Klinger guardrails around the initial withdrawal rate */
+	GUARDRAILS = 1,
+
+	/* The initial withdrawal rate of the current portfolio */
+	PERCENT_OF_PORTFOLIO = 2,
+
+	/* The percent-of-portfolio withdrawal within a floor and a ceiling */
+	FLOOR_CEILING = 3,
+
+	MAX = FLOOR_CEILING
+};
+
+/* Names of the rules in profiles, in the order of SpendingRule */
+constexpr std::string_view SPENDING_RULE_NAMES[] = {
+	"fixed", "guardrails", "percent-of-portfolio", "floor-ceiling"
+};
+
+/* Guardrails: distance of the guardrails from the initial withdrawal rate,
+ * as a fraction of it, and the spending cut or raise of crossing one */
+const float GUARDRAIL_BAND = 0.2f;
+const float GUARDRAIL_STEP = 0.1f;
+
+/* Floor and ceiling of the floor-ceiling rule, as fractions of the
+ * planned withdrawal */
+const float SPENDING_FLOOR = 0.85f;
+const float SPENDING_CEILING = 1.25f;
+
+/**
+ * @brief The planned net expense, whatever the path.
+ */
+class FixedSpending {
+public:
+	explicit FixedSpending(int /* yearsTillRetirement */) {}
+
+	/**
+	 * @brief Gets the withdrawal of a year.
+	 *
+	 * @param year Year of the path.
+	 * @param planned Planned net expense of the year.
+	 * @param portfolio Value of the available accounts and the cash reserve.
+	 * @return The net expense to withdraw.
+	 */
+	long int withdrawal(int /* year */, long int planned, long int /* portfolio */) {
+		return planned;
+	}
+};
+
+/**
+ * @brief Guyton-Klinger guardrails around the initial withdrawal rate.
+ */
+class GuardrailSpending {
+private:
+	/* First year of retirement, from which the rule applies */
+	int retirement_;
+
+	/* Withdrawal rate of the first retirement year with a withdrawal, 0
+	 * before it */
+	float initialRate_ = 0.0f;
+
+	/* Spending relative to the plan, after the adjustments so far */
+	float scale_ = 1.0f;
+
+public:
+	explicit GuardrailSpending(int yearsTillRetirement) : retirement_(yearsTillRetirement) {}
+
+	/* See FixedSpending::withdrawal() */
+	long int withdrawal(int year, long int planned, long int portfolio) {
+		if ((year < retirement_) || (planned <= 0) || (portfolio <= 0)) {
+			return planned;
+		}
+		float rate = scale_ * planned / portfolio;
+		if (initialRate_ == 0.0f) {
+			initialRate_ = rate;
+		}
+		else if (rate > initialRate_ * (1 + GUARDRAIL_BAND)) {
+			scale_ *= 1 - GUARDRAIL_STEP;
+		}
+		else if (rate < initialRate_ * (1 - GUARDRAIL_BAND)) {
+			scale_ *= 1 + GUARDRAIL_STEP;
+		}
+		return static_cast<long int>(scale_ * planned);
+	}
+};
+
+/**
+ * @brief The initial withdrawal rate of the current portfolio, within the
+ *        floor and ceiling if Bounded.
+ */
+template <bool Bounded>
+class PortfolioSpending {
+private:
+	/* First year of retirement, from which the rule applies */
+	int retirement_;
+
+	/* Withdrawal rate of the first retirement year with a withdrawal, 0
+	 * before it */
+	float initialRate_ = 0.0f;
+
+public:
+	explicit PortfolioSpending(int yearsTillRetirement) : retirement_(yearsTillRetirement) {}
+
+	/* See FixedSpending::withdrawal() */
+	long int withdrawal(int year, long int planned, long int portfolio) {
+		if ((year < retirement_) || (planned <= 0) || (portfolio <= 0)) {
+			return planned;
+		}
+		if (initialRate_ == 0.0f) {
+			initialRate_ = float(planned) / portfolio;
+		}
+		float spent = initialRate_ * portfolio;
+		if (Bounded) {
+			spent = std::min(std::max(spent, SPENDING_FLOOR * planned), SPENDING_CEILING * planned);
+		}
+		return static_cast<long int>(spent);
+	}
+};
+
+#endif /* SPENDING_POLICY_H_ */
@@ -0,0 +1,244 @@
+/* ============================================================================
+ * studyRun.h
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Declares the interface of long Monte Carlo studies: runs of a set of
+ *  profiles over more iterations than fit in one scenario bank. A study
+ *  generates its scenarios in blocks, adds each block's longevity counts
+ *  to its aggregate state, and can periodically save that state to a
+ *  small checkpoint file to resume from after a crash or preemption.
+ *
+ *  Because scenario i is always generated from ScenarioRng(seed, i) and
+ *  the counts simply add up, a resumed study gives exactly the results of
+ *  an uninterrupted one. For the same reason a study can be split into
+ *  shards, contiguous ranges of iterations run by separate processes,
+ *  whose state files merge into the results of a single-process run.
+ *
+ *  File Format:
+ *    A StudyStateHeader followed by one StudyProfileRecord per profile,
+ *    little-endian. The checksum is the 64-bit FNV-1a checksum of all
+ *    records (see profileBinary.h). Files are replaced atomically.
+ *
+ *  Dependencies:
+ *    - personalFinSim.h
+ *    - threadPool.h
+ *    - userDataLoading.h
+ *
+ *  Related Files:
+ *    - studyRun.cpp
+ *
+ *  Created:    October 2026
+ *  Author:     Yuping X
+ * ============================================================================
+ */
+
+#ifndef STUDY_RUN_H_
+#define STUDY_RUN_H_
+
+#include <string>
+#include <vector>
+#include <ostream>
+#include <cstdint>
+#include "constants.h"
+#include "personalFinSim.h"
+#include "threadPool.h"
+#include "userDataLoading.h"
+
+/* Number of scenarios generated and held in memory at a time */
+const unsigned int STUDY_BLOCK_SCENARIOS = 64 * 1024;
+
+/* Default interval between two checkpoints, in seconds */
+const unsigned int STUDY_CHECKPOINT_SECONDS = 60;
+
+/* Magic number at the start of every study state file */
+const char STUDY_STATE_MAGIC[4] = {'P', 'F', 'S', 'S'};
+
+/* Format version; increment whenever the file layout changes */
+const uint16_t STUDY_STATE_VERSION = 5;
+
+/* Size of the profile id field (including the terminating zero) */
+const unsigned int STUDY_ID_SIZE = 32;
+
+/**
+ * @brief Header of a study state file.
+ */
+struct StudyStateHeader {
+	char magic[4];
+	uint16_t version;
+	uint16_t recordSize;
+	uint32_t profileCount;
+	uint32_t model;
+	uint32_t inflation;
+	uint32_t tax;
+	uint32_t step;
+	uint32_t mortality;
+	uint64_t seed;
+	uint64_t modelHash;
+	uint64_t totalIterations;
+	uint64_t firstIteration;
+	uint64_t endIteration;
+	uint64_t nextIteration;
+	uint64_t checksum;
+};
+
+/**
+ * @brief Aggregate state of one profile in a study state file.
+ */
+struct StudyProfileRecord {
+	uint64_t profileHash;
+	char profileId[STUDY_ID_SIZE];
+	uint32_t longevityCounts[MAX_YEARS + 1];
+	uint32_t iterations;
+	int32_t predefinedLongevity;
+	int32_t constantLongevity;
+};
+
+static_assert(sizeof(StudyStateHeader) == 88, "Unexpected study header layout");
+static_assert(sizeof(StudyProfileRecord) == 256, "Unexpected study record layout");
+
+/**
+ * @brief Aggregate state of a study over the iterations
+ *        [firstIteration, endIteration) of a run of totalIterations.
+ */
+struct StudyState {
+	/* Seed of the run */
+	uint64_t seed = 0;
+
+	/* Randomized model of the run */
+	ModelOption model = ModelOption::RECESSION_RANDOMIZED;
+
+	/* Inflation model of the run */
+	InflationOption inflation = InflationOption::CONSTANT;
+
+	/* Tax model of the run */
+	TaxOption tax = TaxOption::NONE;
+
+	/* Time step of the run */
+	StepOption step = StepOption::ANNUAL;
+
+	/* Mortality model of the run */
+	MortalityOption mortality = MortalityOption::NONE;
+
+	/* Hash of the simulation models (see scenarioModelHash()) */
+	uint64_t modelHash = 0;
+
+	/* Number of iterations of the whole run */
+	uint64_t totalIterations = 0;
+
+	/* Iterations covered by this state */
+	uint64_t firstIteration = 0;
+	uint64_t endIteration = 0;
+
+	/* First iteration not simulated yet; the RNG counter position */
+	uint64_t nextIteration = 0;
+
+	/* Canonical hash of each profile (see studyProfileHash()) */
+	std::vector<uint64_t> profileHashes;
+
+	/* Aggregated results of each profile */
+	std::vector<SimResult> results;
+};
+
+/**
+ * @brief Hashes the canonical form of a profile.
+ *
+ * @param user Profile to hash.
+ * @return The hash; profiles differing only by names hash equally.
+ */
+uint64_t studyProfileHash(const UserData& user);
+
+/**
+ * @brief Creates the initial state of a study and runs the deterministic
+ *        models of every profile.
+ *
+ * @param profiles Profiles of the study.
+ * @param seed Seed of the run.
+ * @param totalIterations Number of iterations of the whole run.
+ * @param firstIteration First iteration covered by the state.
+ * @param endIteration One past the last iteration covered by the state.
+ * @param model Randomized model of the run.
+ * @param inflation Inflation model of the run.
+ * @param tax Tax model of the run.
+ * @param step Time step of the run.
+ * @param mortality Mortality model of the run.
+ * @return The state, with no randomized iteration run yet.
+ */
+StudyState initStudy(const std::vector<UserData>& profiles, uint64_t seed,
+                     uint64_t totalIterations, uint64_t firstIteration, uint64_t endIteration,
+                     ModelOption model = ModelOption::RECESSION_RANDOMIZED,
+                     InflationOption inflation = InflationOption::CONSTANT,
+                     TaxOption tax = TaxOption::NONE,
+                     StepOption step = StepOption::ANNUAL,
+                     MortalityOption mortality = MortalityOption::NONE);
+
+/**
+ * @brief Checks that a state was made for the given profiles and for the
+ *        current simulation models.
+ *
+ * @param state State to check.
+ * @param profiles Profiles of the study.
+ * @throws std::runtime_error if they do not match.
+ */
+void checkStudyProfiles(const StudyState& state, const std::vector<UserData>& profiles);
+
+/**
+ * @brief Runs the remaining iterations of a study.
+ *
+ * @param profiles Profiles of the study, in the order of the state.
+ * @param state State to continue from and update.
+ * @param pool Thread pool to simulate on.
+ * @param checkpointFile File to save the state to periodically and at the
+ *        end; empty for no checkpoints.
+ * @param checkpointSeconds Minimum interval between two checkpoints.
+ * @param progress Stream to report each checkpoint on; nullptr for none.
+ * @throws std::runtime_error if the state does not match the profiles or
+ *         a checkpoint cannot be written.
+ */
+void runStudy(const std::vector<UserData>& profiles, StudyState& state, ThreadPool& pool,
+              const std::string& checkpointFile, unsigned int checkpointSeconds,
+              std::ostream* progress = nullptr);
+
+/**
+ * @brief Gets the iterations [first, end) of shard index of count shards
+ *        of a run. Shards are contiguous and cover the run exactly.
+ *
+ * @param totalIterations Number of iterations of the whole run.
+ * @param index Index of the shard, in [0, count).
+ * @param count Number of shards.
+ * @param first Set to the first iteration of the shard.
+ * @param end Set to one past the last iteration of the shard.
+ */
+void shardRange(uint64_t totalIterations, uint64_t index, uint64_t count,
+                uint64_t& first, uint64_t& end);
+
+/**
+ * @brief Merges the finished states of the shards of one run.
+ *
+ * @param shards States of the shards, in any order.
+ * @return The state of the whole run, as if it ran in one process.
+ * @throws std::runtime_error if the shards are not all finished, are of
+ *         different runs or profiles, or do not cover the run exactly once.
+ */
+StudyState mergeStudyStates(const std::vector<StudyState>& shards);
+
+/**
+ * @brief Writes a study state file atomically.
+ *
+ * @param filename Path to the file.
+ * @param state State to write.
+ * @throws std::runtime_error if the file cannot be written.
+ */
+void writeStudyState(const std::string& filename, const StudyState& state);
+
+/**
+ * @brief Reads a study state file.
+ *
+ * @param filename Path to the file.
+ * @return The state.
+ * @throws std::runtime_error if the file cannot be read, is of another
+ *         version, or is corrupted.
+ */
+StudyState readStudyState(const std::string& filename);
+
+#endif /* STUDY_RUN_H_ */
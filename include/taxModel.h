@@ -0,0 +1,132 @@
+/* ============================================================================
+ * taxModel.h
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Declares the federal income tax model. By default distributions are
+ *  spent as if they were after tax. With the tax model, each year's
+ *  ordinary income (pension and distributions from the tax-deferred IRA and
+ *  401k accounts) and long-term capital gains (the gain over the cost basis
+ *  of what is sold from the individual account) are taxed, and the tax is
+ *  paid in the following year out of the same distributions as expenses.
+ *  Roth distributions are tax free, and job income is take-home pay, net of
+ *  its tax already.
+ *
+ *  The brackets are in today's dollars and indexed to inflation, so a
+ *  year's income is deflated to year-0 dollars, taxed, and the tax inflated
+ *  back. The gains are stacked on top of the ordinary income, as in the
+ *  federal qualified dividends and capital gains worksheet.
+ *
+ *  The brackets are loaded once per process, with the deduction as one
+ *  more bracket taxed at 0 at the bottom, and with the tax accumulated up
+ *  to the start of each bracket. Taxing an income is then a count of the
+ *  bracket starts it reaches, which compares it with every start the same
+ *  way and does not branch on the bracket it falls in, and one multiply in
+ *  that bracket (see TaxTable::tax()). Gains are taxed as the tax of the
+ *  gains brackets on ordinary income plus gains, less the one on ordinary
+ *  income alone.
+ *
+ *  Table File Format:
+ *    Key = value lines, # comments, see data/tax_brackets.ini:
+ *      Deduction = amount
+ *      Ordinary-brackets = start:rate, start:rate, ...
+ *      Gains-brackets = start:rate, start:rate, ...
+ *
+ *  Related Files:
+ *    - taxModel.cpp
+ *    - asset.h / asset.cpp
+ *    - data/tax_brackets.ini
+ *
+ *  Created:    October 2026
+ *  Author:     Yuping X
+ * ============================================================================
+ */
+
+#ifndef TAX_MODEL_H_
+#define TAX_MODEL_H_
+
+#include <array>
+#include <string>
+#include <cstdint>
+
+/**
+ * @brief Tax models of a simulation run.
+ */
+enum class TaxOption : uint32_t {
+	/* Distributions are spent as if they were after tax */
+	NONE = 0,
+
+	/* Federal income tax on ordinary income and capital gains */
+	FEDERAL = 1,
+
+	MAX = FEDERAL
+};
+
+/* Tax brackets used by the simulator */
+const std::string TAX_TABLE_FILE = "data/tax_brackets.ini";
+
+/* Maximum number of ordinary income and capital gains brackets; with the
+ * deduction, they fill two and one vectors of four lanes */
+const unsigned int TAX_MAX_BRACKETS = 7;
+const unsigned int TAX_MAX_GAINS_BRACKETS = 3;
+
+/**
+ * @brief Federal income tax brackets, prepared for the tax kernel.
+ */
+class TaxTable {
+private:
+	/* Brackets of one kind of income, with the deduction: start of each
+	 * bracket in the income before the deduction, rate, and tax of the
+	 * income up to the start. Unused brackets start past any income */
+	template <unsigned int LANES>
+	struct Brackets {
+		std::array<float, LANES> start;
+		std::array<float, LANES> rate;
+		std::array<float, LANES> base;
+
+		/* Tax of an income, which must not be negative */
+		float tax(float income) const;
+	};
+
+	Brackets<TAX_MAX_BRACKETS + 1> ordinary_;
+	Brackets<TAX_MAX_GAINS_BRACKETS + 1> gains_;
+
+	/* Checksum of the table parameters, identifying the table */
+	uint64_t checksum_;
+
+public:
+	/**
+	 * @brief Loads a table file.
+	 *
+	 * @param filename Path to the table file.
+	 * @throws std::runtime_error if the file cannot be read, is malformed,
+	 *         misses a key, or a bracket list is not valid.
+	 */
+	explicit TaxTable(const std::string& filename);
+
+	/**
+	 * @brief Gets the table of TAX_TABLE_FILE, loaded on first use.
+	 *
+	 * @return The shared table.
+	 * @throws std::runtime_error if the file cannot be loaded.
+	 */
+	static const TaxTable& shared();
+
+	/**
+	 * @brief Gets the checksum of the table parameters.
+	 *
+	 * @return The checksum.
+	 */
+	uint64_t checksum() const;
+
+	/**
+	 * @brief Computes the tax of a year's income, in year-0 dollars.
+	 *
+	 * @param ordinary Ordinary income, not negative.
+	 * @param gains Long-term capital gains, not negative.
+	 * @return The total tax.
+	 */
+	float tax(float ordinary, float gains) const;
+};
+
+#endif /* TAX_MODEL_H_ */
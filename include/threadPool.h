@@ -0,0 +1,112 @@
+/* ============================================================================
+ * threadPool.h
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Declares the ThreadPool class, a fixed set of worker threads that run
+ *  submitted tasks. One pool is shared by all simulations of a process.
+ *
+ *  Related Files:
+ *    - threadPool.cpp
+ *
+ *  Created:    October 2026
+ *  Author:     Yuping X
+ * ============================================================================
+ */
+
+#ifndef THREAD_POOL_H_
+#define THREAD_POOL_H_
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <cstddef>
+
+/**
+ * @brief Fixed-size pool of worker threads with a shared task queue.
+ */
+class ThreadPool {
+private:
+	/* Worker threads */
+	std::vector<std::thread> workers_;
+
+	/* Tasks waiting for a worker */
+	std::deque<std::function<void()>> tasks_;
+
+	/* Number of tasks submitted but not finished yet */
+	size_t pending_;
+
+	/* Set when the pool is being destroyed */
+	bool stopping_;
+
+	std::mutex mutex_;
+	std::condition_variable taskAvailable_;
+	std::condition_variable allDone_;
+
+	/**
+	 * @brief Worker thread main loop.
+	 */
+	void workerLoop();
+
+public:
+	/**
+	 * @brief Starts the worker threads.
+	 *
+	 * @param threads Number of workers; 0 uses one per hardware thread.
+	 */
+	explicit ThreadPool(unsigned int threads = 0);
+
+	/**
+	 * @brief Finishes all queued tasks and joins the workers.
+	 */
+	~ThreadPool();
+
+	/**
+	 * @brief Gets the number of worker threads.
+	 *
+	 * @return The number of workers.
+	 */
+	unsigned int size() const;
+
+	/**
+	 * @brief Queues a task to run on a worker.
+	 *
+	 * @param task Task to run.
+	 */
+	void submit(std::function<void()> task);
+
+	/**
+	 * @brief Blocks until every submitted task has finished.
+	 *
+	 * Must not be called from a task running on this pool.
+	 */
+	void wait();
+
+	/**
+	 * @brief Runs body(i) for every i in [0, count) on the workers and waits
+	 * for all of them.
+	 *
+	 * Indices are handed out in contiguous blocks, a few per worker. If
+	 * body throws, the first exception is rethrown once all blocks finish.
+	 * Must not be called from a task running on this pool.
+	 *
+	 * @param count Number of indices.
+	 * @param body Function to run for each index.
+	 */
+	void parallelFor(size_t count, const std::function<void(size_t)>& body);
+
+	/**
+	 * @brief Copy constructor (disallowed).
+	 */
+	ThreadPool(const ThreadPool&) = delete;
+
+	/**
+	 * @brief Copy assignment operator (disallowed).
+	 */
+	ThreadPool& operator=(const ThreadPool&) = delete;
+};
+
+#endif /* THREAD_POOL_H_ */
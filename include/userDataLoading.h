@@ -22,6 +22,10 @@
 #define USER_DATA_LOADING_H_
 
 #include <string>
+#include <string_view>
+#include <vector>
+#include <charconv>
+#include <system_error>
 #include "constants.h"
 
 const std::string USERDATA_DIR = "data/";
@@ -35,6 +39,11 @@ const std::string USERDATA_FILE_ENDING = "_profile.ini";
  * typically populated from a user-supplied `.ini` file.
  */
 struct UserData {
+    /**
+     * @brief Identifier of the profile (user name or household id).
+     */
+    std::string profileId;
+
     /**
      * @brief Names of investment accounts.
      */
@@ -102,9 +111,138 @@ struct UserData {
      *       pensions such as Social Security and company pensions.
      */
     unsigned short yearsTillPension;
+
+    /**
+     * @brief Birth year of the owner of the tax-deferred accounts, which
+     *       sets their required minimum distributions (see rmdTable.h).
+     *       0 if not given, in which case none are required.
+     */
+    unsigned short birthYear;
+
+    /**
+     * @brief Sex of the owner for the life table of the mortality model:
+     *       1 for male, 2 for female, 0 if not given (see modelMortality.h).
+     */
+    unsigned short sex;
+
+    /**
+     * @brief Spending rule of the withdrawals from retirement on, a
+     *       SpendingRule code (see spendingPolicy.h). 0 if not given, in
+     *       which case the planned net expense is withdrawn.
+     */
+    unsigned short spendingRule;
+
+    /**
+     * @brief Target of the cash reserve in years of net expense. 0 if not
+     *       given, in which case no cash is held apart.
+     */
+    float cashReserveYears;
+
+    /**
+     * @brief Lowest return of the individual account in the previous year
+     *       for the cash reserve to be refilled.
+     */
+    float cashReserveRefill;
+
+    /**
+     * @brief Covariance matrix of the accounts' annual returns, used by the
+     *       correlated per-account model. All zeros (no [Covariance]
+     *       section) selects the default matrix (see modelCorrelated.h).
+     */
+    float covariance[MAX_ACCOUNTS][MAX_ACCOUNTS];
+
+    /**
+     * @brief Life-event expense of each year in today's dollars, on top of
+     *       the cost of living (negative for an income), compiled from the
+     *       [Events] section. All zeros without events.
+     */
+    int eventExpense[MAX_YEARS];
 };
 
 
+/**
+ * @brief Keys of the [General] profile section.
+ *
+ * The same names are used as column names by the household book loader.
+ */
+enum class GeneralKey : int {
+    COST_OF_LIVING = 0,
+    TAKEHOME_INCOME,
+    ROTH_CONTRIBUTION,
+    IRA_CONTRIBUTION,
+    R401K_CONTRIBUTION,
+    PENSION_ESTIMATE,
+    INFLATION,
+    YEARS_TILL_RETIREMENT,
+    YEARS_TILL_WITHDRAWAL,
+    YEARS_TILL_PENSION,
+    BIRTH_YEAR,
+    CASH_RESERVE_YEARS,
+    CASH_RESERVE_REFILL,
+    SEX,
+    SPENDING_RULE,
+    COUNT
+};
+
+/**
+ * @brief First optional [General] key. The keys before it are required in
+ *        household books and streamed profiles; the ones from it on are 0
+ *        when not given, as in an INI profile.
+ */
+const GeneralKey FIRST_OPTIONAL_GENERAL_KEY = GeneralKey::BIRTH_YEAR;
+
+/**
+ * @brief Looks up a [General] key name.
+ *
+ * @param key Key name, e.g. "Cost-of-living".
+ * @return The matching GeneralKey, or GeneralKey::COUNT if unknown.
+ */
+GeneralKey lookupGeneralKey(std::string_view key);
+
+/**
+ * @brief Parses a [General] value into the matching UserData field.
+ *
+ * @param user UserData struct to populate.
+ * @param generalKey Field to set.
+ * @param value Text of the value, without surrounding blanks.
+ * @return std::errc() on success, otherwise the parse error.
+ */
+std::errc parseGeneralValue(UserData& user, GeneralKey generalKey, std::string_view value);
+
+/**
+ * @brief Trims blanks at the beginning and end of a string.
+ *
+ * @param s String to trim.
+ * @return View of s without leading and trailing blanks.
+ */
+std::string_view trim(std::string_view s);
+
+/**
+ * @brief Splits a comma-separated list into trimmed fields.
+ *
+ * @param list Text of the list.
+ * @return Views of the fields of list, at least one.
+ */
+std::vector<std::string_view> splitList(std::string_view list);
+
+/**
+ * @brief Parses the whole of a string as a number.
+ *
+ * @param s Text to parse.
+ * @param out Parsed number; left unchanged on error.
+ * @return std::errc() on success, std::errc::invalid_argument if s is not
+ *         entirely a number, or std::errc::result_out_of_range if it does
+ *         not fit in T.
+ */
+template <typename T>
+std::errc parseNumber(std::string_view s, T& out) {
+    auto [ptr, ec] = std::from_chars(s.data(), s.data() + s.size(), out);
+    if ((ec == std::errc()) && (ptr != s.data() + s.size())) {
+        return std::errc::invalid_argument;
+    }
+    return ec;
+}
+
 /**
  * @brief Loads user financial settings from an INI-style configuration file.
  *
@@ -121,9 +259,10 @@ void loadUserFinancialProfile(UserData& user, const std::string filename);
  * Checks for values such as non-negative income, valid retirement years, etc.
  *
  * @param user User data to validate.
+ * @param verbose If true, print an error for each out-of-bounds value.
  * @return true if the data is valid, false otherwise.
  */
-bool userDataWithinBounds(const UserData& user);
+bool userDataWithinBounds(const UserData& user, bool verbose = true);
 
 /**
  * @brief Prints a summary of the user's financial input to stdout.
@@ -0,0 +1,68 @@
+/* ============================================================================
+ * aliasTable.cpp
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Implementation of the AliasTable class.
+ *
+ *  Dependencies:
+ *    - aliasTable.h
+ *
+ *  Created:    October 2026
+ *  Author:     Yuping X
+ * ============================================================================
+ */
+
+#include <cmath>
+#include <stdexcept>
+#include "../include/aliasTable.h"
+
+AliasTable::AliasTable(const std::vector<double>& weights)
+{
+	double total = 0;
+	for (double weight : weights) {
+		if (!std::isfinite(weight) || (weight < 0)) {
+			throw std::runtime_error("Distribution weights must be finite and non-negative");
+		}
+		total += weight;
+	}
+	if (weights.empty() || (weights.size() > UINT32_MAX) || (total <= 0)) {
+		throw std::runtime_error("Distribution must have at least one outcome of positive weight");
+	}
+
+	/* Scale so that the average column holds exactly 1 */
+	size_t n = weights.size();
+	std::vector<double> scaled(n);
+	std::vector<uint32_t> small, large;
+	for (size_t i = 0; i < n; i++) {
+		scaled[i] = weights[i] * n / total;
+		((scaled[i] < 1.0) ? small : large).push_back(static_cast<uint32_t>(i));
+	}
+
+	/* Vose: fill each underfull column with the excess of an overfull one */
+	std::vector<double> keep(n, 1.0);
+	std::vector<uint32_t> alias(n);
+	for (size_t i = 0; i < n; i++) {
+		alias[i] = static_cast<uint32_t>(i);
+	}
+	while (!small.empty() && !large.empty()) {
+		uint32_t s = small.back();
+		small.pop_back();
+		uint32_t l = large.back();
+		keep[s] = scaled[s];
+		alias[s] = l;
+		scaled[l] -= 1.0 - scaled[s];
+		if (scaled[l] < 1.0) {
+			large.pop_back();
+			small.push_back(l);
+		}
+	}
+	/* Columns left over are full, up to rounding */
+
+	columns_.resize(n);
+	for (size_t i = 0; i < n; i++) {
+		double threshold = std::ldexp(keep[i], 32);
+		columns_[i].threshold = (threshold >= 4294967295.0) ? UINT32_MAX : static_cast<uint32_t>(threshold);
+		columns_[i].alias = (keep[i] >= 1.0) ? static_cast<uint32_t>(i) : alias[i];
+	}
+}
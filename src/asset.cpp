@@ -8,6 +8,9 @@
  *  Dependencies:
  *    - asset.h
  *    - constants.h
+ *    - profileSchedule.h
+ *    - taxModel.h
+ *    - spendingPolicy.h
  *
  *  Related Files:
  *    - modelRecession.h / modelRecession.cpp
@@ -21,13 +24,16 @@
 #include <algorithm>
 #include "../include/asset.h"
 #include "../include/constants.h"
+#include "../include/profileSchedule.h"
+#include "../include/taxModel.h"
+#include "../include/spendingPolicy.h"
 
 int Asset::getFundLongevity()
 {
 	return fundLongevity_;
 }
 
-int Asset::getCashReserve()
+long int Asset::getCashReserve()
 {
 	return cashReserve_;
 }
@@ -35,7 +41,7 @@ int Asset::getCashReserve()
 /* We use available funds in the asset with index asset_num to replenish cash
  * reserve.
  */
-bool Asset::addCashReserve(int cash, int asset_num, int n_year)
+bool Asset::addCashReserve(long int cash, int asset_num, int n_year)
 {
 	if (value_[asset_num][n_year] > cash)
 	{
@@ -56,115 +62,182 @@ void Asset::clearCashReserve()
 
 void Asset::calculateN()
 {
+	/* Derive the deterministic cash flows from the current data members,
+	 * then simulate against the current growth curves. */
+	ProfileSchedule schedule;
+	schedule.initializeFromAsset(*this);
+	expense_ = schedule.expense_;
+
+	calculateN(schedule);
+}
+
+int Asset::fastForwardAccumulation(const ProfileSchedule& schedule)
+{
+	/* Resume the regular loop in the retirement year, or in the last year
+	 * if the whole horizon is spent accumulating */
+	const int years = std::min(schedule.yearsTillRetirement_, (int) MAX_YEARS - 1);
+
+	/* Suffix products of the growth factors: growthProduct[i] is the
+	 * combined growth from the end of year i to the resume year */
+	std::array<double, MAX_YEARS> growthProduct;
+
+	for (int c = 0; c < MAX_ACCOUNTS; c++)
+	{
+		double product = 1.0;
+		for (int i = years - 1; i >= 0; i--)
+		{
+			growthProduct[i] = product;
+			product *= 1.0 + growthRate_[c][i];
+		}
+
+		double total = value_[c][0] * product;
+		for (int i = 0; i < years; i++)
+		{
+			total += schedule.contribution_[c][i] * growthProduct[i];
+		}
+
+		std::fill(distribution_[c].begin(), distribution_[c].begin() + years, 0);
+		value_[c][years] = static_cast<long int>(total);
+	}
+
+	if (DEBUG_PRINT)
+	{
+		std::cout << "DEBUG: fast-forwarded " << years \
+		          << " accumulation years. " << '\n';
+	}
+
+	return years;
+}
+
+void Asset::calculateN(const ProfileSchedule& schedule, const TaxTable* tax, int horizon)
+{
+	/* One loop per spending rule, chosen once per path */
+	switch (schedule.spendingRule_)
+	{
+		case SpendingRule::GUARDRAILS:
+			calculateWithPolicy<GuardrailSpending>(schedule, tax, horizon);
+			break;
+		case SpendingRule::PERCENT_OF_PORTFOLIO:
+			calculateWithPolicy<PortfolioSpending<false>>(schedule, tax, horizon);
+			break;
+		case SpendingRule::FLOOR_CEILING:
+			calculateWithPolicy<PortfolioSpending<true>>(schedule, tax, horizon);
+			break;
+		default:
+			calculateWithPolicy<FixedSpending>(schedule, tax, horizon);
+			break;
+	}
+}
+
+template <class Policy>
+void Asset::calculateWithPolicy(const ProfileSchedule& schedule, const TaxTable* tax, int horizon)
+{
+	Policy policy(schedule.yearsTillRetirement_);
 	long int distributable_total;
-	int pension_income;
+	long int net_expense;
 	float distribution_percentage;
 	int i;
-	bool cashAdded;
-
-	for (i = 0; i < MAX_YEARS; i++)
-	{		
-		/* Once retirement year is reached, deactivate recurring income and
-		 * contributions */
-		if (i == yearsTillRetirement_) {
-			if (DEBUG_PRINT) {
-				std::cout << "DEBUG: This is the year of retirement. \n " << '\n';
-			}
-			takehomeIncome_ = 0;
-			contributionRoth_ = 0;
-			contributionIra_ = 0;
-			contributionR401k_ = 0;
-		}
 
-		if (i >= yearsTillPension_) {
-			/* If pension income is available */
-			pension_income = pensionEstimate_;
-		} 
-		else {
-			pension_income = 0;
-		}
+	/* Tax state of the path: cost basis of the individual account, whose
+	 * sales are taxed on their gain over it, and last year's tax, which is
+	 * paid this year */
+	float basis = schedule.initialValue_[INDIVIDUAL_INDEX];
+	long int taxDue = 0;
 
-		/* Decide if we should use cash reserve
-		 * If growth within the past year is negative, use cash reserve (if available)
-		 * If growth within the past year is above a threshold and cash reserve is depleted, replenish it
-		 * For now we assume cash reserve is always less than one year's expense and we take it as a whole
-		 * TODO: add possibility to use partial cash reserve
-		 * TODO: refine cash reserve logic
-		 */
+	/* Reset the per-path state */
+	for (int c = 0; c < MAX_ACCOUNTS; c++)
+	{
+		value_[c][0] = schedule.initialValue_[c];
+	}
+	clearCashReserve();
 
-		if ((i > 0) && (growthRate_[INDIVIDUAL_INDEX][i - 1] < 0) && (cashReserve_ > 0))
+	/* Skip the branchy loop through the accumulation phase when nothing
+	 * has to be distributed. The cash reserve then stays empty, as its
+	 * target is a share of the net expense */
+	i = 0;
+	bool taxedAccumulation = false;
+	if (tax != nullptr)
+	{
+		/* A pension is taxed even in years nothing is distributed */
+		int years = std::min(schedule.yearsTillRetirement_, (int) MAX_YEARS);
+		taxedAccumulation = std::any_of(schedule.pension_.begin(), schedule.pension_.begin() + years,
+		                                [](long int pension) { return pension != 0; });
+	}
+	if (schedule.accumulationFastPath_ && !taxedAccumulation && \
+	    (schedule.rmdStartYear_ >= schedule.yearsTillRetirement_))
+	{
+		i = fastForwardAccumulation(schedule);
+		for (int j = 0; j < i; j++)
 		{
-			if (DEBUG_PRINT)
-			{
-				std::cout << "DEBUG: year " << CURRENT_YEAR + i \
-				          << " cash reserve " << cashReserve_ << " used up " << '\n';
-			}
-			expense_[i] -= Asset::cashReserve_;
-			clearCashReserve();
+			basis += schedule.contribution_[INDIVIDUAL_INDEX][j];
 		}
-		else if ((i > 0) && (growthRate_[INDIVIDUAL_INDEX][i - 1] > 0) && (cashReserve_ == 0))
-		{
-			cashAdded = Asset::addCashReserve(CASH_RESERVE, INDIVIDUAL_INDEX, i);
-			if (DEBUG_PRINT)
-			{
-				if (cashAdded)
-				{
-					std::cout << "DEBUG: year " << CURRENT_YEAR + i \
-					          << " cash reserve replenished." << '\n';
-				}
-				else
-				{
-					std::cout << "DEBUG: year " << CURRENT_YEAR + i \
-					          << " unable to replenish cash reserve." << '\n';
-				}
-			}
+	}
+
+	for (; i < horizon; i++)
+	{
+		if (DEBUG_PRINT && (i == schedule.yearsTillRetirement_)) {
+			std::cout << "DEBUG: This is the year of retirement. \n " << '\n';
 		}
 
-		/* Then calculate current year distribution */
+		/* Calculate current year distribution */
 		distributable_total = 0;
 		for (int c = 0; c < MAX_ACCOUNTS; c++)
 		{
-			if (availability_[c][i])
+			if (schedule.availability_[c][i])
 			{
 				distributable_total += value_[c][i];
 			}
 		}
 
-		/* Calculate current year actual expense and potential surplus for
-		 * investing considering this year's takehome income.
-		 * */
-		long int net_expense = std::max(expense_[i] - takehomeIncome_ - pension_income, (long int) 0);
-		long int contribution_individual = std::max(takehomeIncome_ + pension_income - expense_[i], (long int) 0);
+		/* This year's expense not covered by job and pension income, as the
+		 * spending rule adjusts it to the path, and last year's tax */
+		net_expense = policy.withdrawal(i, schedule.netExpense_[i], distributable_total + cashReserve_) + \
+		              taxDue;
+
+		/* Cash reserve: in the year after a loss of the individual account,
+		 * the net expense is drawn from the reserve first, as far as it
+		 * goes, and so is what the accounts cannot cover in any year. In
+		 * year 0 and after a year returning at least the refill threshold,
+		 * the reserve is topped up to its target from the individual
+		 * account, with what the accounts can spare beyond this year's
+		 * expense. Both are computed by selects, min and max rather than
+		 * branches, and are 0 without a reserve. */
+		const float lastReturn = (i > 0) ? growthRate_[INDIVIDUAL_INDEX][i - 1] : schedule.cashReserveRefill_;
+		long int drawn = std::min(cashReserve_,
+			std::max((lastReturn < 0) ? net_expense : 0, net_expense - distributable_total));
+		net_expense -= drawn;
+		cashReserve_ -= drawn;
+
+		long int target = static_cast<long int>(schedule.cashReserveYears_ * schedule.netExpense_[i]);
+		long int spare = std::min(value_[INDIVIDUAL_INDEX][i], distributable_total - net_expense);
+		long int refill = (lastReturn >= schedule.cashReserveRefill_) ? \
+			std::max(std::min(target - cashReserve_, spare), (long int) 0) : 0;
+		value_[INDIVIDUAL_INDEX][i] -= refill;
+		distributable_total -= refill;
+		cashReserve_ += refill;
+
+		if (DEBUG_PRINT && ((drawn != 0) || (refill != 0)))
+		{
+			std::cout << "DEBUG: year " << CURRENT_YEAR + i \
+			          << " cash reserve drawn " << drawn << ", refilled " << refill \
+			          << ", now " << cashReserve_ << '\n';
+		}
 
 		if (net_expense > distributable_total)
 		{
-			if (net_expense < distributable_total + cashReserve_)
-			{
-				/* This is a corner case when expense is less than investments
-				 * but can be covered by the cash reserve */
-				if (DEBUG_PRINT)
-				{
-					std::cout << "DEBUG: year " << CURRENT_YEAR + i \
-					          << " cash reserve " << cashReserve_ \
-							  << " used up " << '\n';
-				}
-				expense_[i] -= cashReserve_;
-				clearCashReserve();
-			}
-			else
-			{
-				break;
-			}
+			break;
 		}
 
-		distribution_percentage = float(net_expense) / float(distributable_total);
+		/* Nothing to distribute from (and nothing needed) in this year */
+		distribution_percentage = (distributable_total > 0) ?
+			float(net_expense) / float(distributable_total) : 0.0f;
 
 		if (DEBUG_PRINT)
 		{
 			std::cout << "DEBUG: Job income: " \
-			          << takehomeIncome_ << '\n';
+			          << schedule.income_[i] << '\n';
 			std::cout << "DEBUG: Pension income: " \
-			          << pension_income << '\n';
+			          << schedule.pension_[i] << '\n';
 			std::cout << "DEBUG: Net expense (after considering income): " \
 			          << net_expense << '\n';
 			std::cout << "DEBUG: year " << CURRENT_YEAR + i \
@@ -172,12 +245,23 @@ void Asset::calculateN()
 					  << '\n';
 		}
 
+		/* Fraction of the tax-deferred accounts required to be distributed,
+		 * and what they distribute beyond their share of the net expense */
+		const float required = schedule.rmdRate_[i];
+		long int forced = 0;
+
 		for (int c = 0; c < MAX_ACCOUNTS; c++)
 		{
-			if (availability_[c][i])
+			if (schedule.availability_[c][i])
 			{
 				/* Next, take out distribution */ 
 				distribution_[c][i] = value_[c][i] * distribution_percentage;
+				if (((c == IRA_INDEX) || (c == R401K_INDEX)) && (required > distribution_percentage))
+				{
+					long int minimum = value_[c][i] * required;
+					forced += minimum - distribution_[c][i];
+					distribution_[c][i] = minimum;
+				}
 				if (DEBUG_PRINT)
 				{
 					std::cout << "DEBUG: Asset #" << c \
@@ -190,11 +274,14 @@ void Asset::calculateN()
 				Asset::distribution_[c][i] = 0;
 			}
 			/* Next, if we haven't reached MAX_YEARS, calculate the remaining
-			 * value plus growth, which will be next year's pre-distribution value
+			 * value plus growth, which will be next year's pre-distribution
+			 * value, and build each account by this year's contribution (which
+			 * is zero from retirement on).
 			 */
 			if (i + 1 < MAX_YEARS) {
 				value_[c][i + 1] = (value_[c][i] - distribution_[c][i]) * (
 					1 + growthRate_[c][i]);
+				value_[c][i + 1] += schedule.contribution_[c][i];
 			}
 				
 			if (DEBUG_PRINT)
@@ -206,42 +293,48 @@ void Asset::calculateN()
 			}
 		}
 
-		/* Build each investment account by current year contribution if before
-		 * retirement */
-		if ((i < yearsTillRetirement_) && (i + 1 < MAX_YEARS)) {
-			value_[INDIVIDUAL_INDEX][i + 1] += contribution_individual;
-			value_[ROTH_INDEX][i + 1] += contributionRoth_;
-			value_[IRA_INDEX][i + 1] += contributionIra_;
-			value_[R401K_INDEX][i + 1] += contributionR401k_;
-
-		    /* Update roth, ira and 401k contributions by the rate of inflation.
-			 * Since we don't know future contribution limits, this is a reasonable
-			 * estimate.
-			 * */
-			contributionRoth_ = contributionRoth_ * (1 + inflation_[i]);
-			contributionIra_ = contributionIra_ * (1 + inflation_[i]);
-			contributionR401k_ = contributionR401k_ * (1 + inflation_[i]);
-
-			/* Grow user's next year takehome job income by the rate of inflation */
-			takehomeIncome_ = takehomeIncome_ * (1 + inflation_[i]);
-
-		}
-
-		/* Update next year's projected expense and pension income: */
-		if (i + 1 < MAX_YEARS) {
-			expense_[i + 1] = expense_[i] * (1 + inflation_[i]);
-			pensionEstimate_ = pensionEstimate_ * (1 + inflation_[i]);
+		/* Required distributions beyond the net expense are reinvested in
+		 * the individual account */
+		if ((forced > 0) && (i + 1 < MAX_YEARS))
+		{
+			value_[INDIVIDUAL_INDEX][i + 1] += forced;
+			if (DEBUG_PRINT)
+			{
+				std::cout << "DEBUG: Required distribution reinvested: " << forced << '\n';
+			}
 		}
 
-		/* Finally, grow cash reserve (if available) by the rate of inflation */
-
-		if (cashReserve_ > 0)
+		if (tax != nullptr)
 		{
-			cashReserve_ = cashReserve_ * (1 + inflation_[i]);
+			/* Pension and tax-deferred distributions are ordinary income,
+			 * and what is sold from the individual account is taxed on its
+			 * gain over its share of the (average) cost basis. The tax is
+			 * computed in year-0 dollars, as the brackets are indexed to
+			 * inflation. Refilling the cash reserve is a sale as well */
+			float held = value_[INDIVIDUAL_INDEX][i] + refill;
+			float refilled = (held > 0) ? refill / held : 0.0f;
+			float share = distribution_percentage * (1 - refilled) + refilled;
+			float sold = distribution_[INDIVIDUAL_INDEX][i] + refill;
+			float gains = std::max(sold - basis * share, 0.0f);
+			basis = basis * (1 - share) + schedule.contribution_[INDIVIDUAL_INDEX][i] + forced;
+
+			float ordinary = schedule.pension_[i] + distribution_[IRA_INDEX][i] + distribution_[R401K_INDEX][i];
+			float level = schedule.priceLevel_[i];
+			float deflator = 1.0f / level;
+			taxDue = static_cast<long int>(level * tax->tax(ordinary * deflator, gains * deflator));
+
+			if (DEBUG_PRINT)
+			{
+				std::cout << "DEBUG: Tax due next year: " << taxDue << '\n';
+			}
 		}
+
+		/* Finally, grow the cash reserve by the rate of inflation */
+		cashReserve_ = cashReserve_ * (1 + schedule.inflation_[i]);
 	}
 
-	fundLongevity_ = i;
+	/* A fast-forward may pass a death year before retirement */
+	fundLongevity_ = std::min(i, horizon);
 
 	if (DEBUG_PRINT)
 	{
@@ -261,6 +354,7 @@ void Asset::initializeFromUserData(const UserData& user) {
 		growthRateAvg_[c] = user.rate[c];
 		distribution_[c][0] = 0;
 	}
+	factorCovariance(user, returnFactor_);
 	expense_[0] = user.initialExpense;
 	takehomeIncome_ = user.takehomeIncome;
 	contributionRoth_ = user.contributionRoth;
@@ -276,7 +370,6 @@ void Asset::initializeFromUserData(const UserData& user) {
 	availability_[IRA_INDEX][0] = false;
 	availability_[R401K_INDEX][0] = false;
 	clearCashReserve();
-	addCashReserve(CASH_RESERVE, INDIVIDUAL_INDEX, 0);
 
 	for (int i = 1; i < MAX_YEARS; i++) {
 		for (int c = 0; c < MAX_ACCOUNTS; c++) {
@@ -310,6 +403,7 @@ Asset::Asset()
 	contributionIra_ = 0;
 	contributionR401k_ = 0;
 	pensionEstimate_ = 0;
+	yearsTillPension_ = 0;
 
 	for (int c = 0; c < MAX_ACCOUNTS; c++)
 	{
@@ -324,6 +418,8 @@ Asset::Asset()
 		}
 
 		growthRateAvg_[c] = 0.0f;
+		returnFactor_.mean[c] = 0.0f;
+		returnFactor_.lower[c].fill(0.0f);
 	}
 
 	for (int y = 0; y < MAX_YEARS; y++)
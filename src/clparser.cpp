@@ -18,11 +18,17 @@
  */
 
 #include <iostream>
+#include <fstream>
 #include <string>
+#include <vector>
+#include <algorithm>
 #include <filesystem>
 #include <regex>
+#include <charconv>
+#include <fnmatch.h>
 #include "../include/clparser.h"
 #include "../include/userDataLoading.h"
+#include "../include/profileBinary.h"
 
 static void displayWelcomeMsg() {
     std::cout << std::endl;
@@ -31,28 +37,288 @@ static void displayWelcomeMsg() {
     std::cout << "   (for personal use only; no advice implied)"    << std::endl;
     std::cout << "================================================" << std::endl;
     std::cout << std::endl;
-    std::cout << "Usage: ./build/pfsim --user <name>" << std::endl;
+    std::cout << "Usage: ./build/pfsim --user <name> [--user <name> ...]" << std::endl;
+    std::cout << "       ./build/pfsim --user '<glob>' | --user-list <names.txt>" << std::endl;
+    std::cout << "       ./build/pfsim --book <households.csv>" << std::endl;
+    std::cout << "       ./build/pfsim --compiled <profiles.pfsb>" << std::endl;
+    std::cout << "       ./build/pfsim --stdin-ndjson [--in-flight <n>] < profiles.ndjson" << std::endl;
+    std::cout << "       ./build/pfsim serve [--socket <path>] [--in-flight <n>]" << std::endl;
+    std::cout << "       ./build/pfsim compile (--user <name> | --book <households.csv>)" \
+              << " [--output <profiles.pfsb>]" << std::endl;
+    std::cout << "Options: --seed <n> (reproducible randomized runs)," << std::endl;
+    std::cout << "         --model recession|historical|regime|correlated" << std::endl;
+    std::cout << "           (randomized model; default recession)," << std::endl;
+    std::cout << "         --inflation constant|stochastic" << std::endl;
+    std::cout << "           (inflation of the randomized paths; default constant)," << std::endl;
+    std::cout << "         --tax none|federal" << std::endl;
+    std::cout << "           (income tax on pension and distributions; default none)," << std::endl;
+    std::cout << "         --step annual|monthly" << std::endl;
+    std::cout << "           (time step of the simulation; default annual)," << std::endl;
+    std::cout << "         --mortality none|life-table" << std::endl;
+    std::cout << "           (end each randomized path at a drawn death year; default none)," << std::endl;
+    std::cout << "         --threads <n> (simulation threads; default all cores)," << std::endl;
+    std::cout << "         --deadline-ms <n> (best estimate within n ms per profile)," << std::endl;
+    std::cout << "         --cache-mb <n> (result cache of serve and --stdin-ndjson; default " \
+              << RESULT_CACHE_DEFAULT_MB << ")," << std::endl;
+    std::cout << "         --iterations <n> (randomized iterations; default " << ITERATIONS << ")," << std::endl;
+    std::cout << "         --checkpoint <file> [--checkpoint-seconds <n>] [--resume]" << std::endl;
+    std::cout << "           (save long runs every n seconds, default " << STUDY_CHECKPOINT_SECONDS \
+              << ", and resume them)" << std::endl;
+    std::cout << "         --shard <i>/<n> (run shard i of n, 0 <= i < n, of a study with" << std::endl;
+    std::cout << "           --seed and --checkpoint; combine shards with pfsim-merge)" << std::endl;
     std::cout << "Example: ./build/pfsim --user demo" << std::endl;
     std::cout << "See README for more information such as adding " << std::endl;
     std::cout << "your own user profile." << std::endl;
     std::cout << std::endl;
 }
 
-void clArgParser(ClArgs& params, int argc, char** argv) {
-    displayWelcomeMsg();
+static const std::regex valid_user_regex("^[a-zA-Z0-9-_]+$");
+static const std::regex valid_glob_regex("^[a-zA-Z0-9-_*?\\[\\]]+$");
 
-    std::regex valid_user_regex("^[a-zA-Z0-9-_]+$");
+/**
+ * @brief Adds the profile files of a user name or glob to the list.
+ *
+ * A glob (containing *, ? or [) is matched against the names of the
+ * profiles in USERDATA_DIR, which are added in sorted order.
+ *
+ * @param userFiles List of profile files to extend.
+ * @param name User name or glob.
+ */
+static void addUser(std::vector<std::string>& userFiles, const std::string& name) {
+    if (std::regex_match(name, valid_user_regex)) {
+        userFiles.push_back(USERDATA_DIR + name + USERDATA_FILE_ENDING);
+        return;
+    }
+    if (!std::regex_match(name, valid_glob_regex)) {
+        std::cerr << "ERROR: Invalid user name " << name << ". " \
+                  << "Only letters, digits, dashes (-), and underscores (_) allowed, " \
+                  << "plus *, ? and [] in globs." \
+                  << std::endl;
+        exit(1);
+    }
 
+    std::vector<std::string> matches;
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator(USERDATA_DIR, ec)) {
+        std::string file = entry.path().filename().string();
+        if ((file.size() <= USERDATA_FILE_ENDING.size()) ||
+            (file.compare(file.size() - USERDATA_FILE_ENDING.size(),
+                          USERDATA_FILE_ENDING.size(), USERDATA_FILE_ENDING) != 0)) {
+            continue;
+        }
+        std::string user = file.substr(0, file.size() - USERDATA_FILE_ENDING.size());
+        if (fnmatch(name.c_str(), user.c_str(), 0) == 0) {
+            matches.push_back(USERDATA_DIR + file);
+        }
+    }
+
+    if (matches.empty()) {
+        std::cerr << "ERROR: No user profile matches " << name << std::endl;
+        exit(1);
+    }
+    std::sort(matches.begin(), matches.end());
+    userFiles.insert(userFiles.end(), matches.begin(), matches.end());
+}
+
+/**
+ * @brief Adds the users of a list file, one name or glob per line. Empty
+ * lines and lines starting with # are ignored.
+ *
+ * @param userFiles List of profile files to extend.
+ * @param listFile File listing the users.
+ */
+static void addUserList(std::vector<std::string>& userFiles, const std::string& listFile) {
+    std::ifstream file(listFile);
+    if (!file.is_open()) {
+        std::cerr << "ERROR: Could not open user list " << listFile << std::endl;
+        exit(1);
+    }
+
+    std::string line;
+    while (std::getline(file, line)) {
+        std::string_view name = trim(line);
+        if (name.empty() || (name.front() == '#')) {
+            continue;
+        }
+        addUser(userFiles, std::string(name));
+    }
+}
+
+/**
+ * @brief Parses a non-negative integer option value, exiting on error.
+ */
+template <typename T>
+static T parseOptionNumber(const std::string& option, const char* text) {
+    T value{};
+    std::string_view sv(text);
+    auto [ptr, ec] = std::from_chars(sv.data(), sv.data() + sv.size(), value);
+    if ((ec != std::errc()) || (ptr != sv.data() + sv.size())) {
+        std::cerr << "ERROR: Invalid value for " << option << ": " << text << std::endl;
+        exit(1);
+    }
+    return value;
+}
+
+void clArgParser(ClArgs& params, int argc, char** argv) {
+    /* Results are streamed to stdout, so keep it clean in streaming mode */
     for (int i = 1; i < argc; i++) {
+        params.stdinNdjson = params.stdinNdjson || (std::string(argv[i]) == "--stdin-ndjson");
+    }
+    if (!params.stdinNdjson) {
+        displayWelcomeMsg();
+    }
+
+    int first = 1;
+    if ((argc > 1) && (std::string(argv[1]) == "compile")) {
+        params.compile = true;
+        first = 2;
+    }
+    else if ((argc > 1) && (std::string(argv[1]) == "serve")) {
+        params.serve = true;
+        first = 2;
+    }
+
+    for (int i = first; i < argc; i++) {
         std::string arg = argv[i];
         if ((arg == "--user") && (i+1 < argc)) {
-            if (!std::regex_match(argv[++i], valid_user_regex)) {
-                std::cerr << "ERROR: Invalid user name. " \
-                          << "Only letters, digits, dashes (-), and underscores (_) allowed." \
-                          << std::endl;
+            addUser(params.userFiles, argv[++i]);
+        }
+        else if ((arg == "--user-list") && (i+1 < argc)) {
+            addUserList(params.userFiles, argv[++i]);
+        }
+        else if ((arg == "--seed") && (i+1 < argc)) {
+            params.seed = parseOptionNumber<uint64_t>(arg, argv[++i]);
+            params.seedGiven = true;
+        }
+        else if ((arg == "--model") && (i+1 < argc)) {
+            std::string model = argv[++i];
+            if (model == "recession") {
+                params.randomModel = ModelOption::RECESSION_RANDOMIZED;
+            }
+            else if (model == "historical") {
+                params.randomModel = ModelOption::HISTORICAL_BOOTSTRAP;
+            }
+            else if (model == "regime") {
+                params.randomModel = ModelOption::REGIME_SWITCHING;
+            }
+            else if (model == "correlated") {
+                params.randomModel = ModelOption::CORRELATED_ACCOUNTS;
+            }
+            else {
+                std::cerr << "ERROR: Unknown model " << model << " (expected recession, historical, regime or correlated)" << std::endl;
+                exit(1);
+            }
+            params.modelGiven = true;
+        }
+        else if ((arg == "--inflation") && (i+1 < argc)) {
+            std::string inflation = argv[++i];
+            if (inflation == "constant") {
+                params.inflationModel = InflationOption::CONSTANT;
+            }
+            else if (inflation == "stochastic") {
+                params.inflationModel = InflationOption::STOCHASTIC;
+            }
+            else {
+                std::cerr << "ERROR: Unknown inflation model " << inflation << " (expected constant or stochastic)" << std::endl;
+                exit(1);
+            }
+            params.inflationGiven = true;
+        }
+        else if ((arg == "--tax") && (i+1 < argc)) {
+            std::string tax = argv[++i];
+            if (tax == "none") {
+                params.taxModel = TaxOption::NONE;
+            }
+            else if (tax == "federal") {
+                params.taxModel = TaxOption::FEDERAL;
+            }
+            else {
+                std::cerr << "ERROR: Unknown tax model " << tax << " (expected none or federal)" << std::endl;
+                exit(1);
+            }
+            params.taxGiven = true;
+        }
+        else if ((arg == "--step") && (i+1 < argc)) {
+            std::string step = argv[++i];
+            if (step == "annual") {
+                params.stepOption = StepOption::ANNUAL;
+            }
+            else if (step == "monthly") {
+                params.stepOption = StepOption::MONTHLY;
+            }
+            else {
+                std::cerr << "ERROR: Unknown time step " << step << " (expected annual or monthly)" << std::endl;
+                exit(1);
+            }
+            params.stepGiven = true;
+        }
+        else if ((arg == "--mortality") && (i+1 < argc)) {
+            std::string mortality = argv[++i];
+            if (mortality == "none") {
+                params.mortalityOption = MortalityOption::NONE;
+            }
+            else if (mortality == "life-table") {
+                params.mortalityOption = MortalityOption::LIFE_TABLE;
+            }
+            else {
+                std::cerr << "ERROR: Unknown mortality model " << mortality << " (expected none or life-table)" << std::endl;
+                exit(1);
+            }
+            params.mortalityGiven = true;
+        }
+        else if ((arg == "--threads") && (i+1 < argc)) {
+            params.threads = parseOptionNumber<unsigned int>(arg, argv[++i]);
+        }
+        else if ((arg == "--socket") && (i+1 < argc) && params.serve) {
+            params.socketPath = argv[++i];
+        }
+        else if ((arg == "--stdin-ndjson") && !params.compile && !params.serve) {
+            /* Already handled above */
+        }
+        else if ((arg == "--in-flight") && (i+1 < argc)) {
+            params.inFlight = parseOptionNumber<size_t>(arg, argv[++i]);
+        }
+        else if ((arg == "--deadline-ms") && (i+1 < argc)) {
+            params.deadlineMs = parseOptionNumber<unsigned int>(arg, argv[++i]);
+        }
+        else if ((arg == "--cache-mb") && (i+1 < argc)) {
+            params.cacheMb = parseOptionNumber<size_t>(arg, argv[++i]);
+        }
+        else if ((arg == "--iterations") && (i+1 < argc)) {
+            params.iterations = parseOptionNumber<uint64_t>(arg, argv[++i]);
+        }
+        else if ((arg == "--checkpoint") && (i+1 < argc)) {
+            params.checkpointFile = argv[++i];
+        }
+        else if ((arg == "--checkpoint-seconds") && (i+1 < argc)) {
+            params.checkpointSeconds = parseOptionNumber<unsigned int>(arg, argv[++i]);
+        }
+        else if ((arg == "--shard") && (i+1 < argc)) {
+            std::string shard = argv[++i];
+            size_t slash = shard.find('/');
+            if (slash == std::string::npos) {
+                std::cerr << "ERROR: Invalid value for --shard: " << shard << " (expected i/n)" << std::endl;
+                exit(1);
+            }
+            params.shardIndex = parseOptionNumber<uint64_t>(arg, shard.substr(0, slash).c_str());
+            params.shardCount = parseOptionNumber<uint64_t>(arg, shard.substr(slash + 1).c_str());
+            if (params.shardIndex >= params.shardCount) {
+                std::cerr << "ERROR: --shard i/n requires 0 <= i < n" << std::endl;
                 exit(1);
             }
-            params.filename = USERDATA_DIR + argv[i] + USERDATA_FILE_ENDING;
+            params.shardGiven = true;
+        }
+        else if (arg == "--resume") {
+            params.resume = true;
+        }
+        else if ((arg == "--book") && (i+1 < argc)) {
+            params.bookFile = argv[++i];
+        }
+        else if ((arg == "--compiled") && (i+1 < argc) && !params.compile) {
+            params.compiledFile = argv[++i];
+        }
+        else if ((arg == "--output") && (i+1 < argc) && params.compile) {
+            params.outputFile = argv[++i];
         }
         else if (arg == "--help") {
             displayWelcomeMsg();
@@ -64,10 +330,62 @@ void clArgParser(ClArgs& params, int argc, char** argv) {
         }
     }
 
-    if (!std::filesystem::exists(params.filename)) {
-        std::cerr << "File " << params.filename << " not found! " \
-                  << "Check spelling or create file and try again." \
-                  << std::endl;
-        exit(1); // Exit with error
+    if (params.stdinNdjson || params.serve) {
+        if (!params.userFiles.empty() || !params.bookFile.empty() || !params.compiledFile.empty()) {
+            std::cerr << "ERROR: profiles are streamed in this mode and cannot be given as files" << std::endl;
+            exit(1);
+        }
+        if ((params.iterations > 0) || !params.checkpointFile.empty() || params.resume || params.shardGiven) {
+            std::cerr << "ERROR: --iterations, --checkpoint, --resume and --shard do not apply to streamed profiles" << std::endl;
+            exit(1);
+        }
+        return;
+    }
+
+    /* Results count iterations in 32 bits */
+    if (params.iterations > UINT32_MAX) {
+        std::cerr << "ERROR: --iterations must be at most " << UINT32_MAX << std::endl;
+        exit(1);
+    }
+    if (params.resume && params.checkpointFile.empty()) {
+        std::cerr << "ERROR: --resume requires --checkpoint <file>" << std::endl;
+        exit(1);
+    }
+    if (params.shardGiven && (params.checkpointFile.empty() || (!params.seedGiven && !params.resume))) {
+        /* Shards of one study must share the seed, and their results are
+         * only useful saved */
+        std::cerr << "ERROR: --shard requires --seed <n> and --checkpoint <file>" << std::endl;
+        exit(1);
+    }
+    if ((params.iterations > 0 || !params.checkpointFile.empty()) && params.deadlineMs > 0) {
+        std::cerr << "ERROR: --deadline-ms cannot be combined with --iterations or --checkpoint" << std::endl;
+        exit(1);
+    }
+
+    /* Without any input, simulate the default profile */
+    if (params.userFiles.empty() && params.bookFile.empty() && params.compiledFile.empty()) {
+        params.userFiles.push_back(params.filename);
+    }
+
+    std::vector<std::string> inputFiles;
+    if (!params.compiledFile.empty()) {
+        inputFiles.push_back(params.compiledFile);
+    }
+    if (!params.bookFile.empty()) {
+        inputFiles.push_back(params.bookFile);
+    }
+    inputFiles.insert(inputFiles.end(), params.userFiles.begin(), params.userFiles.end());
+
+    if (params.compile && params.outputFile.empty()) {
+        params.outputFile = std::filesystem::path(inputFiles[0]).replace_extension(PROFILE_BINARY_FILE_ENDING).string();
+    }
+
+    for (const std::string& inputFile : inputFiles) {
+        if (!std::filesystem::exists(inputFile)) {
+            std::cerr << "File " << inputFile << " not found! " \
+                      << "Check spelling or create file and try again." \
+                      << std::endl;
+            exit(1); // Exit with error
+        }
     }
 }
\ No newline at end of file
@@ -0,0 +1,315 @@
+/* ============================================================================
+ * householdBook.cpp
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Implements bulk loading of a CSV or TSV book of households. The file is
+ *  memory-mapped, split into row ranges at line boundaries, and every range
+ *  is parsed and validated by its own thread directly into its slots of one
+ *  contiguous vector of profiles.
+ *
+ *  Dependencies:
+ *    - householdBook.h
+ *    - mappedFile.h
+ *    - userDataLoading.h
+ *
+ *  Created:    October 2026
+ *  Author:     Yuping X
+ * ============================================================================
+ */
+
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <thread>
+#include <exception>
+#include <stdexcept>
+#include <algorithm>
+#include "../include/householdBook.h"
+#include "../include/mappedFile.h"
+#include "../include/userDataLoading.h"
+#include "../include/constants.h"
+
+/* What a column of the book holds */
+struct BookColumn {
+	enum class Kind { ID, VALUE, RATE, GENERAL } kind;
+
+	/* Account index for VALUE and RATE, GeneralKey for GENERAL */
+	int index;
+};
+
+/* A range of rows parsed by one thread */
+struct BookChunk {
+	std::string_view text;
+
+	/* Line number of the first line of the chunk */
+	size_t firstLine;
+
+	/* Number of lines and of non-empty rows in the chunk */
+	size_t lines;
+	size_t rows;
+
+	/* Index of the chunk's first row in the output vector */
+	size_t firstRow;
+
+	std::exception_ptr error;
+};
+
+/* Splits off the next line of text, without its line ending */
+static std::string_view nextLine(std::string_view& text) {
+	size_t eol = text.find('\n');
+	std::string_view line = text.substr(0, eol);
+	text = (eol == std::string_view::npos) ? std::string_view() : text.substr(eol + 1);
+	if (!line.empty() && (line.back() == '\r')) {
+		line.remove_suffix(1);
+	}
+	return line;
+}
+
+/* Maps each header field to the column it holds */
+static std::vector<BookColumn> parseHeader(std::string_view header, char delimiter) {
+	std::vector<BookColumn> columns;
+	std::vector<bool> seen(1 + 2 * MAX_ACCOUNTS + static_cast<int>(GeneralKey::COUNT), false);
+
+	while (true) {
+		size_t end = header.find(delimiter);
+		std::string_view name = trim(header.substr(0, end));
+		BookColumn column{BookColumn::Kind::ID, 0};
+		size_t slot = 0;
+
+		GeneralKey generalKey = lookupGeneralKey(name);
+		if (name == BOOK_ID_COLUMN) {
+			column = {BookColumn::Kind::ID, 0};
+			slot = 0;
+		}
+		else if (generalKey != GeneralKey::COUNT) {
+			column = {BookColumn::Kind::GENERAL, static_cast<int>(generalKey)};
+			slot = 1 + 2 * MAX_ACCOUNTS + static_cast<int>(generalKey);
+		}
+		else {
+			bool found = false;
+			for (int c = 0; c < MAX_ACCOUNTS; c++) {
+				if (name == BOOK_ACCOUNT_NAMES[c]) {
+					column = {BookColumn::Kind::VALUE, c};
+					slot = 1 + c;
+					found = true;
+				}
+				else if (name == BOOK_ACCOUNT_NAMES[c] + BOOK_RATE_SUFFIX) {
+					column = {BookColumn::Kind::RATE, c};
+					slot = 1 + MAX_ACCOUNTS + c;
+					found = true;
+				}
+			}
+			if (!found) {
+				throw std::runtime_error("Unknown column in household book header: " + \
+				                         std::string(name) + " (column " + \
+				                         std::to_string(columns.size() + 1) + ")");
+			}
+		}
+
+		if (seen[slot]) {
+			throw std::runtime_error("Duplicate column in household book header: " + std::string(name));
+		}
+		seen[slot] = true;
+		columns.push_back(column);
+
+		if (end == std::string_view::npos) {
+			break;
+		}
+		header = header.substr(end + 1);
+	}
+
+	/* Optional [General] keys come last */
+	const size_t required = 1 + 2 * MAX_ACCOUNTS + static_cast<int>(FIRST_OPTIONAL_GENERAL_KEY);
+	if (std::find(seen.begin(), seen.begin() + required, false) != seen.begin() + required) {
+		throw std::runtime_error("Household book header is missing required columns; " \
+		                         "see householdBook.h for the list of columns");
+	}
+	return columns;
+}
+
+/* Parses one row of the book into user */
+static void parseRow(UserData& user, std::string_view row, size_t lineNum,
+                     const std::vector<BookColumn>& columns, char delimiter) {
+	size_t c = 0;
+	while (true) {
+		size_t end = row.find(delimiter);
+		std::string_view field = trim(row.substr(0, end));
+
+		if (c >= columns.size()) {
+			throw std::runtime_error("Invalid format on line " + std::to_string(lineNum) + \
+			                         ": more than " + std::to_string(columns.size()) + " fields");
+		}
+
+		std::errc ec = std::errc();
+		const BookColumn& column = columns[c];
+		switch (column.kind) {
+			case BookColumn::Kind::ID:
+				user.profileId = field;
+				break;
+			case BookColumn::Kind::VALUE:
+				ec = parseNumber(field, user.value[column.index]);
+				break;
+			case BookColumn::Kind::RATE:
+				ec = parseNumber(field, user.rate[column.index]);
+				break;
+			case BookColumn::Kind::GENERAL:
+				ec = parseGeneralValue(user, static_cast<GeneralKey>(column.index), field);
+				break;
+		}
+
+		if (ec == std::errc::result_out_of_range) {
+			throw std::runtime_error("Out-of-range number on line " + std::to_string(lineNum) + \
+			                         ", column " + std::to_string(c + 1) + " '" + std::string(field) + "'");
+		}
+		else if (ec != std::errc()) {
+			throw std::runtime_error("Invalid format on line " + std::to_string(lineNum) + \
+			                         ", column " + std::to_string(c + 1) + " '" + std::string(field) + "'");
+		}
+
+		c++;
+		if (end == std::string_view::npos) {
+			break;
+		}
+		row = row.substr(end + 1);
+	}
+
+	if (c != columns.size()) {
+		throw std::runtime_error("Invalid format on line " + std::to_string(lineNum) + \
+		                         ": expected " + std::to_string(columns.size()) + \
+		                         " fields, found " + std::to_string(c));
+	}
+
+	for (int a = 0; a < MAX_ACCOUNTS; a++) {
+		user.name[a] = BOOK_ACCOUNT_NAMES[a];
+	}
+}
+
+/* Counts the lines and non-empty rows of a chunk */
+static void countRows(BookChunk& chunk) {
+	std::string_view text = chunk.text;
+	chunk.lines = 0;
+	chunk.rows = 0;
+	while (!text.empty()) {
+		std::string_view line = nextLine(text);
+		chunk.lines++;
+		if (!trim(line).empty()) {
+			chunk.rows++;
+		}
+	}
+}
+
+/* Parses and validates the rows of a chunk into their output slots */
+static void parseChunk(BookChunk& chunk, const std::vector<BookColumn>& columns, char delimiter,
+                       std::vector<UserData>& profiles, std::vector<char>& valid) {
+	try {
+		std::string_view text = chunk.text;
+		size_t lineNum = chunk.firstLine;
+		size_t row = chunk.firstRow;
+		while (!text.empty()) {
+			std::string_view line = nextLine(text);
+			if (!trim(line).empty()) {
+				parseRow(profiles[row], line, lineNum, columns, delimiter);
+				valid[row] = userDataWithinBounds(profiles[row], false);
+				row++;
+			}
+			lineNum++;
+		}
+	} catch (...) {
+		chunk.error = std::current_exception();
+	}
+}
+
+std::vector<UserData> loadHouseholdBook(const std::string& filename) {
+	MappedFile file(filename);
+	std::string_view body = file.data();
+
+	std::cout << "Loading household book from file " << filename << "...\n" << std::endl;
+
+	/* The header is the first non-empty line */
+	std::string_view header;
+	size_t headerLine = 0;
+	while (!body.empty() && trim(header).empty()) {
+		header = nextLine(body);
+		headerLine++;
+	}
+	if (trim(header).empty()) {
+		return {};
+	}
+	const char delimiter = (header.find('\t') != std::string_view::npos) ? '\t' : ',';
+	const std::vector<BookColumn> columns = parseHeader(header, delimiter);
+
+	/* Split the body into chunks at line boundaries */
+	size_t threads = std::max(1u, std::thread::hardware_concurrency());
+	size_t numChunks = std::min(threads, body.size() / BOOK_MIN_CHUNK_BYTES + 1);
+	std::vector<BookChunk> chunks(numChunks);
+	size_t start = 0;
+	for (size_t k = 0; k < numChunks; k++) {
+		size_t end = body.size() * (k + 1) / numChunks;
+		if (end < body.size()) {
+			size_t eol = body.find('\n', std::max(end, start));
+			end = (eol == std::string_view::npos) ? body.size() : eol + 1;
+		}
+		end = std::max(end, start);
+		chunks[k].text = body.substr(start, end - start);
+		start = end;
+	}
+
+	/* First pass: count rows so that each chunk knows where its rows go */
+	std::vector<std::thread> workers;
+	for (size_t k = 1; k < numChunks; k++) {
+		workers.emplace_back(countRows, std::ref(chunks[k]));
+	}
+	countRows(chunks[0]);
+	for (std::thread& worker : workers) {
+		worker.join();
+	}
+
+	size_t totalRows = 0;
+	size_t lineNum = headerLine + 1;
+	for (BookChunk& chunk : chunks) {
+		chunk.firstRow = totalRows;
+		chunk.firstLine = lineNum;
+		totalRows += chunk.rows;
+		lineNum += chunk.lines;
+	}
+
+	/* Second pass: parse and validate every row into its slot */
+	std::vector<UserData> profiles(totalRows);
+	std::vector<char> valid(totalRows, 0);
+	workers.clear();
+	for (size_t k = 1; k < numChunks; k++) {
+		workers.emplace_back(parseChunk, std::ref(chunks[k]), std::cref(columns), delimiter,
+		                     std::ref(profiles), std::ref(valid));
+	}
+	parseChunk(chunks[0], columns, delimiter, profiles, valid);
+	for (std::thread& worker : workers) {
+		worker.join();
+	}
+
+	for (BookChunk& chunk : chunks) {
+		if (chunk.error) {
+			std::rethrow_exception(chunk.error);
+		}
+	}
+
+	/* Report and drop out-of-bounds households, keeping file order */
+	size_t kept = 0;
+	for (size_t row = 0; row < totalRows; row++) {
+		if (valid[row]) {
+			if (kept != row) {
+				profiles[kept] = std::move(profiles[row]);
+			}
+			kept++;
+		}
+		else {
+			std::cerr << "ERROR: household " << profiles[row].profileId \
+			          << " has out-of-bounds values and is skipped:" << std::endl;
+			userDataWithinBounds(profiles[row], true);
+		}
+	}
+	profiles.resize(kept);
+
+	return profiles;
+}
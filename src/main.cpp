@@ -5,14 +5,28 @@
  *
  * This file handles:
  *   - Parsing command-line arguments (via clArgParser)
- *   - Loading user financial profile from file
+ *   - Loading user financial profile from file, a book of households, or
+ *     compiled binary profiles
+ *   - Compiling profiles to the binary format (pfsim compile)
+ *   - Streaming NDJSON profiles from stdin (--stdin-ndjson)
+ *   - Serving simulation requests on a Unix domain socket (pfsim serve)
+ *   - Running long studies with checkpoint and resume (--iterations,
+ *     --checkpoint, --resume), whole or in shards (--shard)
  *   - Validating input data
- *   - Invoking simulations across all supported models
+ *   - Invoking simulations across all supported models, running many
+ *     profiles concurrently on one thread pool and scenario bank
  *
  * Dependencies:
  *   - clparser.h        (Command-line argument parsing)
  *   - userDataLoading.h (INI file loading and validation)
  *   - asset.h           (Simulation model and asset logic)
+ *   - householdBook.h   (Bulk CSV/TSV household loading)
+ *   - profileBinary.h   (Compiled binary profiles)
+ *   - personalFinSim.h  (Simulation driver)
+ *   - ndjsonStream.h    (NDJSON streaming over stdin/stdout)
+ *   - simServer.h       (Simulation daemon)
+ *   - resultCache.h     (Result cache of the streaming modes)
+ *   - studyRun.h        (Long runs with checkpoint and resume)
  *
  *  Created: 	June 2025
  *  Author:     Yuping X
@@ -20,11 +34,39 @@
  */
 #include <iostream>
 #include <memory>
+#include <vector>
+#include <iterator>
+#include <csignal>
+#include <chrono>
+#include <stdexcept>
 #include "../include/clparser.h"
 #include "../include/userDataLoading.h"
 #include "../include/asset.h"
+#include "../include/householdBook.h"
+#include "../include/profileBinary.h"
+#include "../include/personalFinSim.h"
+#include "../include/scenarioBank.h"
+#include "../include/threadPool.h"
+#include "../include/ndjsonStream.h"
+#include "../include/simServer.h"
+#include "../include/resultCache.h"
+#include "../include/studyRun.h"
 
-void runSimAll(const UserData& user);
+/* Server stopped by SIGINT and SIGTERM */
+static SimServer* runningServer = nullptr;
+
+static void stopServer(int) {
+    if (runningServer != nullptr) {
+        runningServer->stop();
+    }
+}
+
+/* Prints the counters of a result cache */
+static void displayCacheStats(const CacheStats& stats, std::ostream& out) {
+    out << "Result cache: " << stats.hits << " hit(s), " << stats.misses << " miss(es), " \
+        << stats.evictions << " eviction(s), " << stats.entries << " entries in " \
+        << (stats.bytes >> 10) << " KiB." << std::endl;
+}
 
 int main(int argc, char **argv) {
 
@@ -32,18 +74,206 @@ int main(int argc, char **argv) {
 
     clArgParser(*params, argc, argv);
 
-    std::unique_ptr<UserData> user = std::make_unique<UserData>();
+    if (params->stdinNdjson) {
+        std::ios::sync_with_stdio(false);
+        ThreadPool pool(params->threads);
+        uint64_t seed = params->seedGiven ? params->seed : clockSeed();
+        ScenarioBank bank(seed, ITERATIONS, &pool, params->randomModel, params->inflationModel,
+                          params->taxModel, params->stepOption, params->mortalityOption);
+
+        ResultCache cache(params->cacheMb << 20);
+        StreamOptions options;
+        options.maxInFlight = params->inFlight;
+        options.cache = &cache;
+        options.deadlineMs = params->deadlineMs;
+
+        StreamStats stats = runNdjsonStream(std::cin, std::cout, bank, pool, options);
+        std::cerr << "Streamed " << stats.lines << " profile(s), " \
+                  << stats.errors << " error(s)." << std::endl;
+        displayCacheStats(cache.stats(), std::cerr);
+        return 0;
+    }
+
+    if (params->serve) {
+        ThreadPool pool(params->threads);
+        uint64_t seed = params->seedGiven ? params->seed : clockSeed();
+        ScenarioBank bank(seed, ITERATIONS, &pool, params->randomModel, params->inflationModel,
+                          params->taxModel, params->stepOption, params->mortalityOption);
+
+        ResultCache cache(params->cacheMb << 20);
+        StreamOptions options;
+        options.maxInFlight = params->inFlight;
+        options.cache = &cache;
+        options.deadlineMs = params->deadlineMs;
+
+        SimServer server(params->socketPath, bank, pool, options);
+        runningServer = &server;
+        std::signal(SIGINT, stopServer);
+        std::signal(SIGTERM, stopServer);
+
+        std::cout << "Serving on " << params->socketPath << " with " << pool.size() \
+                  << " thread(s), seed " << seed << ". Press Ctrl-C to stop." << std::endl;
+        server.run();
+        runningServer = nullptr;
+        std::cout << "Server stopped." << std::endl;
+        displayCacheStats(cache.stats(), std::cout);
+        return 0;
+    }
+
+    std::vector<UserData> profiles;
+
+    /* Malformed profiles, books and compiled files end the run with an error */
+    try {
+        if (!params->compiledFile.empty()) {
+            /* Compiled profiles are mapped and used without parsing */
+            CompiledProfiles compiled(params->compiledFile);
+            profiles.resize(compiled.size());
+            for (size_t i = 0; i < compiled.size(); i++) {
+                userDataFromRecord(compiled[i], profiles[i]);
+            }
+        }
+
+        if (!params->bookFile.empty()) {
+            /* Bulk-load every valid household of the book */
+            std::vector<UserData> book = loadHouseholdBook(params->bookFile);
+            profiles.insert(profiles.end(), std::make_move_iterator(book.begin()),
+                            std::make_move_iterator(book.end()));
+        }
+
+        for (const std::string& userFile : params->userFiles) {
+            UserData user{};
+
+            /* Load asset & financial settings */
+            loadUserFinancialProfile(user, userFile);
+
+            if (!userDataWithinBounds(user)) {
+                return 1; // Exit with error
+            }
+            profiles.push_back(std::move(user));
+        }
+    }
+    catch (const std::runtime_error& e) {
+        std::cerr << "ERROR: " << e.what() << std::endl;
+        return 1;
+    }
+
+    if (params->compile) {
+        try {
+            writeCompiledProfiles(params->outputFile, profiles);
+        }
+        catch (const std::runtime_error& e) {
+            std::cerr << "ERROR: " << e.what() << std::endl;
+            return 1;
+        }
+        std::cout << "Compiled " << profiles.size() << " profile(s) to " \
+                  << params->outputFile << std::endl;
+        return 0;
+    }
+
+    if (profiles.empty()) {
+        std::cerr << "ERROR: no valid profile to simulate" << std::endl;
+        return 1;
+    }
+
+    /* All profiles share one pool and one bank of randomized scenarios */
+    ThreadPool pool(params->threads);
+    uint64_t seed = params->seedGiven ? params->seed : clockSeed();
+    std::vector<SimResult> results;
+
+    if ((params->iterations > 0) || !params->checkpointFile.empty()) {
+        /* Long study: scenarios are generated in blocks and checkpointed */
+        StudyState state;
+        /* A corrupt checkpoint or one that cannot be written ends the run
+         * with an error */
+        try {
+            if (params->resume) {
+                state = readStudyState(params->checkpointFile);
+                checkStudyProfiles(state, profiles);
+                if (params->seedGiven && (params->seed != state.seed)) {
+                    std::cerr << "ERROR: the checkpoint was made with seed " << state.seed << std::endl;
+                    return 1;
+                }
+                if (params->modelGiven && (params->randomModel != state.model)) {
+                    std::cerr << "ERROR: the checkpoint was made with another randomized model" << std::endl;
+                    return 1;
+                }
+                if (params->inflationGiven && (params->inflationModel != state.inflation)) {
+                    std::cerr << "ERROR: the checkpoint was made with another inflation model" << std::endl;
+                    return 1;
+                }
+                if (params->taxGiven && (params->taxModel != state.tax)) {
+                    std::cerr << "ERROR: the checkpoint was made with another tax model" << std::endl;
+                    return 1;
+                }
+                if (params->stepGiven && (params->stepOption != state.step)) {
+                    std::cerr << "ERROR: the checkpoint was made with another time step" << std::endl;
+                    return 1;
+                }
+                if (params->mortalityGiven && (params->mortalityOption != state.mortality)) {
+                    std::cerr << "ERROR: the checkpoint was made with another mortality model" << std::endl;
+                    return 1;
+                }
+                if ((params->iterations > 0) && (params->iterations != state.totalIterations)) {
+                    std::cerr << "ERROR: the checkpoint was made for " << state.totalIterations \
+                              << " iterations" << std::endl;
+                    return 1;
+                }
+                uint64_t first, end;
+                shardRange(state.totalIterations, params->shardIndex, params->shardCount, first, end);
+                if (params->shardGiven && ((first != state.firstIteration) || (end != state.endIteration))) {
+                    std::cerr << "ERROR: the checkpoint is not of shard " << params->shardIndex << "/" \
+                              << params->shardCount << std::endl;
+                    return 1;
+                }
+                std::cout << "Resuming at iteration " << state.nextIteration << " of " \
+                          << state.totalIterations << "." << std::endl;
+            }
+            else {
+                uint64_t iterations = (params->iterations > 0) ? params->iterations : ITERATIONS;
+                uint64_t first, end;
+                shardRange(iterations, params->shardIndex, params->shardCount, first, end);
+                state = initStudy(profiles, seed, iterations, first, end, params->randomModel,
+                                  params->inflationModel, params->taxModel, params->stepOption,
+                                  params->mortalityOption);
+            }
+            runStudy(profiles, state, pool, params->checkpointFile, params->checkpointSeconds, &std::cout);
+        }
+        catch (const std::runtime_error& e) {
+            std::cerr << "ERROR: " << e.what() << std::endl;
+            return 1;
+        }
+
+        if ((state.firstIteration != 0) || (state.endIteration != state.totalIterations)) {
+            /* A shard's results are partial: they are only shown merged */
+            std::cout << "Shard of iterations " << state.firstIteration << "-" << state.endIteration \
+                      << " of " << state.totalIterations << " saved to " << params->checkpointFile \
+                      << "; combine all shards with pfsim-merge." << std::endl;
+            return 0;
+        }
+        results = std::move(state.results);
+    }
+    else {
+        ScenarioBank bank(seed, ITERATIONS, &pool, params->randomModel, params->inflationModel,
+                          params->taxModel, params->stepOption, params->mortalityOption);
+        SimClock::time_point deadline = (params->deadlineMs > 0) ?
+            SimClock::now() + std::chrono::milliseconds(params->deadlineMs) : NO_DEADLINE;
+        try {
+            results = simulateProfiles(profiles, bank, pool, deadline);
+        }
+        catch (const std::runtime_error& e) {
+            std::cerr << "ERROR: " << e.what() << std::endl;
+            return 1;
+        }
+    }
 
-    /* Load asset & financial settings */
-    loadUserFinancialProfile(*user, params->filename); 
-    
-    if (!userDataWithinBounds(*user)) {
-        return 1; // Exit with error
+    if ((profiles.size() == 1) && params->bookFile.empty() && params->compiledFile.empty()) {
+        displayUserInfo(profiles[0]);
+        displaySimResult(results[0]);
+        return 0;
     }
-    
-    displayUserInfo(*user);
 
-    runSimAll(*user);
+    std::cout << "Loaded " << profiles.size() << " profile(s)." << std::endl;
+    displaySimResults(results);
 
     return 0;
 }
@@ -0,0 +1,67 @@
+/* ============================================================================
+ * mappedFile.cpp
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Implementation of the MappedFile class using POSIX mmap.
+ *
+ *  Dependencies:
+ *    - mappedFile.h
+ *
+ *  Created:    October 2026
+ *  Author:     Yuping X
+ * ============================================================================
+ */
+
+#include <stdexcept>
+#include <cstring>
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "../include/mappedFile.h"
+
+MappedFile::MappedFile(const std::string& filename)
+{
+	data_ = nullptr;
+	size_ = 0;
+
+	int fd = open(filename.c_str(), O_RDONLY);
+	if (fd < 0) {
+		throw std::runtime_error("Could not open file " + filename + ": " + std::strerror(errno));
+	}
+
+	struct stat st;
+	if (fstat(fd, &st) != 0) {
+		close(fd);
+		throw std::runtime_error("Could not read size of file " + filename + ": " + std::strerror(errno));
+	}
+
+	/* An empty file cannot be mapped, but is a valid (empty) input */
+	if (st.st_size > 0) {
+		void* mapping = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (mapping == MAP_FAILED) {
+			close(fd);
+			throw std::runtime_error("Could not map file " + filename + ": " + std::strerror(errno));
+		}
+		madvise(mapping, st.st_size, MADV_SEQUENTIAL);
+		data_ = static_cast<const char*>(mapping);
+		size_ = static_cast<size_t>(st.st_size);
+	}
+
+	/* The mapping stays valid after the descriptor is closed */
+	close(fd);
+}
+
+MappedFile::~MappedFile()
+{
+	if (data_ != nullptr) {
+		munmap(const_cast<char*>(data_), size_);
+	}
+}
+
+std::string_view MappedFile::data() const
+{
+	return std::string_view(data_, size_);
+}
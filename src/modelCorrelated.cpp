@@ -0,0 +1,205 @@
+/* ============================================================================
+ * modelCorrelated.cpp
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Implements the correlated per-account growth model: covariance
+ *  factoring, unit draws and the batched returns kernel.
+ *
+ *  Dependencies:
+ *    - modelCorrelated.h
+ *    - modelRecession.h (stock market average)
+ *    - asset.h
+ *
+ *  Created:    October 2026
+ *  Author:     Yuping X
+ * ============================================================================
+ */
+
+#include <chrono>
+#include <cmath>
+#include <algorithm>
+#include "../include/modelCorrelated.h"
+#include "../include/modelRecession.h"
+#include "../include/asset.h"
+
+/* Number of unit draws taken from one 64-bit random draw */
+static const unsigned int DRAWS_PER_RANDOM = 64 / NORMAL_TABLE_BITS;
+
+/* Number of bisection steps per quantile; enough for double precision */
+static const unsigned int QUANTILE_STEPS = 64;
+
+bool hasCovariance(const UserData& user) {
+	for (int i = 0; i < MAX_ACCOUNTS; i++) {
+		for (int j = 0; j < MAX_ACCOUNTS; j++) {
+			if (user.covariance[i][j] != 0.0f) {
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+bool factorCovariance(const UserData& user, ReturnFactor& factor) {
+	/* Covariance of the profile, or the default one from the accounts'
+	 * guessed stock ratios (as in Asset::populateGrowthCurves()) */
+	double covariance[MAX_ACCOUNTS][MAX_ACCOUNTS];
+	bool given = hasCovariance(user);
+	for (int i = 0; i < MAX_ACCOUNTS; i++) {
+		for (int j = 0; j < MAX_ACCOUNTS; j++) {
+			if (given) {
+				covariance[i][j] = user.covariance[i][j];
+			}
+			else {
+				double ratioI = std::min(user.rate[i] / STOCK_GROWTH_AVG, 1.0f);
+				double ratioJ = std::min(user.rate[j] / STOCK_GROWTH_AVG, 1.0f);
+				double correlation = (i == j) ? 1.0 : ACCOUNT_CORRELATION_DEFAULT;
+				covariance[i][j] = correlation * ratioI * ratioJ * STOCK_VOLATILITY * STOCK_VOLATILITY;
+			}
+		}
+	}
+
+	/* Cholesky-Banachiewicz, in double precision. A zero pivot (an account
+	 * with no variance of its own) leaves its column zero, which is only
+	 * consistent if the rest of the column is zero too. */
+	bool valid = true;
+	double lower[MAX_ACCOUNTS][MAX_ACCOUNTS] = {};
+	for (int j = 0; j < MAX_ACCOUNTS; j++) {
+		factor.mean[j] = user.rate[j];
+
+		double pivot = covariance[j][j];
+		for (int k = 0; k < j; k++) {
+			pivot -= lower[j][k] * lower[j][k];
+		}
+		if (pivot < -COVARIANCE_TOLERANCE) {
+			valid = false;
+		}
+		lower[j][j] = (pivot > COVARIANCE_TOLERANCE) ? std::sqrt(pivot) : 0.0;
+
+		for (int i = j + 1; i < MAX_ACCOUNTS; i++) {
+			if (std::fabs(covariance[i][j] - covariance[j][i]) > COVARIANCE_TOLERANCE) {
+				valid = false;
+			}
+			double rest = covariance[i][j];
+			for (int k = 0; k < j; k++) {
+				rest -= lower[i][k] * lower[j][k];
+			}
+			if (lower[j][j] > 0) {
+				lower[i][j] = rest / lower[j][j];
+			}
+			else if (std::fabs(rest) > COVARIANCE_TOLERANCE) {
+				valid = false;
+			}
+		}
+	}
+
+	for (int i = 0; i < MAX_ACCOUNTS; i++) {
+		for (int j = 0; j < MAX_ACCOUNTS; j++) {
+			factor.lower[i][j] = static_cast<float>(lower[i][j]);
+		}
+	}
+	return valid;
+}
+
+const std::array<float, NORMAL_TABLE_SIZE>& normalQuantiles() {
+	static const std::array<float, NORMAL_TABLE_SIZE> table = [] {
+		/* Quantile of the midpoint of each of the equally likely cells,
+		 * found by bisection on the normal CDF; the upper half mirrors the
+		 * lower one so that the mean is exactly zero */
+		std::array<double, NORMAL_TABLE_SIZE> quantiles;
+		for (unsigned int i = 0; i < NORMAL_TABLE_SIZE / 2; i++) {
+			double p = (i + 0.5) / NORMAL_TABLE_SIZE;
+			double low = -10.0;
+			double high = 0.0;
+			for (unsigned int step = 0; step < QUANTILE_STEPS; step++) {
+				double middle = (low + high) / 2;
+				if (0.5 * std::erfc(-middle / std::sqrt(2.0)) < p) {
+					low = middle;
+				}
+				else {
+					high = middle;
+				}
+			}
+			quantiles[i] = (low + high) / 2;
+			quantiles[NORMAL_TABLE_SIZE - 1 - i] = -quantiles[i];
+		}
+
+		/* The discrete table has slightly less than unit variance */
+		double variance = 0;
+		for (double q : quantiles) {
+			variance += q * q;
+		}
+		double scale = 1.0 / std::sqrt(variance / NORMAL_TABLE_SIZE);
+
+		std::array<float, NORMAL_TABLE_SIZE> scaled;
+		for (unsigned int i = 0; i < NORMAL_TABLE_SIZE; i++) {
+			scaled[i] = static_cast<float>(quantiles[i] * scale);
+		}
+		return scaled;
+	}();
+	return table;
+}
+
+void generateAccountDraws(AccountDraws& draws, ScenarioRng& generator) {
+	/* The accounts' draws are contiguous, so they fill one flat array,
+	 * DRAWS_PER_RANDOM at a time */
+	static_assert(sizeof(AccountDraws) == sizeof(uint16_t) * MAX_ACCOUNTS * MAX_YEARS,
+	              "Account draws must be contiguous");
+	uint16_t* out = draws[0].data();
+	const unsigned int total = MAX_ACCOUNTS * MAX_YEARS;
+
+	unsigned int i = 0;
+	for (; i + DRAWS_PER_RANDOM <= total; i += DRAWS_PER_RANDOM) {
+		uint64_t bits = generator();
+		for (unsigned int k = 0; k < DRAWS_PER_RANDOM; k++) {
+			out[i + k] = static_cast<uint16_t>((bits >> (k * NORMAL_TABLE_BITS)) & (NORMAL_TABLE_SIZE - 1));
+		}
+	}
+	uint64_t bits = generator();
+	for (unsigned int k = 0; i < total; i++, k++) {
+		out[i] = static_cast<uint16_t>((bits >> (k * NORMAL_TABLE_BITS)) & (NORMAL_TABLE_SIZE - 1));
+	}
+}
+
+void correlateReturns(const ReturnFactor& factor, const AccountDraws* draws, size_t paths,
+                      AccountCurves* growth) {
+	const float* table = normalQuantiles().data();
+	AccountCurves units;
+	for (size_t p = 0; p < paths; p++) {
+		for (int k = 0; k < MAX_ACCOUNTS; k++) {
+			for (int n = 0; n < MAX_YEARS; n++) {
+				units[k][n] = table[draws[p][k][n]];
+			}
+		}
+
+		/* growth = mean + L * units; the year loops are contiguous and
+		 * vectorize, and L is lower triangular */
+		for (int c = 0; c < MAX_ACCOUNTS; c++) {
+			float* out = growth[p][c].data();
+			const float mean = factor.mean[c];
+			for (int n = 0; n < MAX_YEARS; n++) {
+				out[n] = mean;
+			}
+			for (int k = 0; k <= c; k++) {
+				const float weight = factor.lower[c][k];
+				const float* in = units[k].data();
+				for (int n = 0; n < MAX_YEARS; n++) {
+					out[n] += weight * in[n];
+				}
+			}
+		}
+	}
+}
+
+/* =========================================================================
+ * Scenario Definition: Correlated Per-account Returns
+ * ========================================================================= */
+void Asset::scenarioCorrelatedAccounts() {
+	/* Get a time-based seed using high-resolution clock */
+	auto seed = std::chrono::system_clock::now().time_since_epoch().count();
+	ScenarioRng generator(seed, 0);
+
+	AccountDraws draws;
+	generateAccountDraws(draws, generator);
+	correlateReturns(returnFactor_, &draws, 1, &growthRate_);
+}
@@ -0,0 +1,116 @@
+/* ============================================================================
+ * modelHistorical.cpp
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Implements the historical block-bootstrap growth model and the loading
+ *  of its returns table.
+ *
+ *  Dependencies:
+ *    - modelHistorical.h
+ *    - asset.h
+ *    - userDataLoading.h (parsing helpers)
+ *    - profileBinary.h (checksum)
+ *
+ *  Created:    October 2026
+ *  Author:     Yuping X
+ * ============================================================================
+ */
+
+#include <fstream>
+#include <chrono>
+#include <cstring>
+#include <algorithm>
+#include <stdexcept>
+#include "../include/modelHistorical.h"
+#include "../include/asset.h"
+#include "../include/userDataLoading.h"
+#include "../include/profileBinary.h"
+
+HistoricalReturns::HistoricalReturns(const std::string& filename)
+	: years_(0), checksum_(0)
+{
+	std::ifstream file(filename);
+	if (!file.is_open()) {
+		throw std::runtime_error("Could not open historical returns " + filename);
+	}
+
+	std::string line;
+	size_t lineNum = 0;
+	bool headerSeen = false;
+	while (std::getline(file, line)) {
+		lineNum++;
+		std::string_view row = trim(line);
+		if (row.empty() || (row.front() == '#')) {
+			continue;
+		}
+		if (!headerSeen) {
+			headerSeen = true;
+			if (row != "Year,Return") {
+				throw std::runtime_error(filename + ": expected the header Year,Return");
+			}
+			continue;
+		}
+
+		size_t comma = row.find(',');
+		int year = 0;
+		float rate = 0;
+		if ((comma == std::string_view::npos) || \
+		    (parseNumber(trim(row.substr(0, comma)), year) != std::errc()) || \
+		    (parseNumber(trim(row.substr(comma + 1)), rate) != std::errc()) || \
+		    (rate <= -1.0f)) {
+			throw std::runtime_error(filename + ":" + std::to_string(lineNum) + ": malformed row");
+		}
+		unrolled_.push_back(rate);
+	}
+
+	if (unrolled_.size() < HISTORICAL_BLOCK_YEARS) {
+		throw std::runtime_error(filename + " holds fewer than " + \
+		                         std::to_string(HISTORICAL_BLOCK_YEARS) + " years");
+	}
+	years_ = static_cast<uint32_t>(unrolled_.size());
+	checksum_ = profileChecksum(unrolled_.data(), unrolled_.size() * sizeof(float));
+
+	/* Unroll: blocks starting in the last years wrap around to the first */
+	for (unsigned int n = 0; n + 1 < HISTORICAL_BLOCK_YEARS; n++) {
+		unrolled_.push_back(unrolled_[n]);
+	}
+}
+
+const HistoricalReturns& HistoricalReturns::shared()
+{
+	static const HistoricalReturns table(HISTORICAL_RETURNS_FILE);
+	return table;
+}
+
+uint32_t HistoricalReturns::years() const
+{
+	return years_;
+}
+
+uint64_t HistoricalReturns::checksum() const
+{
+	return checksum_;
+}
+
+/* =========================================================================
+ * Scenario Definition: Block Bootstrap of Historical Returns
+ * ========================================================================= */
+void Asset::scenarioHistoricalBootstrap(std::array<float, MAX_YEARS>& growth_common) {
+	/* Get a time-based seed using high-resolution clock */
+	auto seed = std::chrono::system_clock::now().time_since_epoch().count();
+	ScenarioRng generator(seed, 0);
+
+	generateHistoricalBootstrap(growth_common, generator, HistoricalReturns::shared());
+}
+
+void generateHistoricalBootstrap(std::array<float, MAX_YEARS>& growth_common, ScenarioRng& generator,
+                                 const HistoricalReturns& table) {
+	const uint64_t years = table.years();
+	for (unsigned int n = 0; n < MAX_YEARS; n += HISTORICAL_BLOCK_YEARS) {
+		/* Uniform block start in [0, years) by multiply-shift, no division */
+		uint32_t start = static_cast<uint32_t>(((generator() >> 32) * years) >> 32);
+		unsigned int count = std::min(HISTORICAL_BLOCK_YEARS, MAX_YEARS - n);
+		std::memcpy(growth_common.data() + n, table.block(start), count * sizeof(float));
+	}
+}
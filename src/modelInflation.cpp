@@ -0,0 +1,85 @@
+/* ============================================================================
+ * modelInflation.cpp
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Implements the stochastic inflation model.
+ *
+ *  Dependencies:
+ *    - modelInflation.h
+ *    - modelRecession.h (stock market average)
+ *    - modelCorrelated.h (stock market volatility, normal quantiles)
+ *
+ *  Created:    October 2026
+ *  Author:     Yuping X
+ * ============================================================================
+ */
+
+#include <cmath>
+#include "../include/modelInflation.h"
+#include "../include/modelRecession.h"
+#include "../include/modelCorrelated.h"
+
+/* Number of unit draws taken from one 64-bit random draw */
+static const unsigned int DRAWS_PER_RANDOM = 64 / NORMAL_TABLE_BITS;
+
+static_assert(MAX_YEARS % DRAWS_PER_RANDOM == 0, "Years must fill whole blocks of draws");
+
+/* Powers of INFLATION_PERSISTENCE, carrying a deviation forward k years */
+static const std::array<float, DRAWS_PER_RANDOM + 1> persistencePowers = [] {
+	std::array<float, DRAWS_PER_RANDOM + 1> powers;
+	powers[0] = 1.0f;
+	for (unsigned int k = 1; k <= DRAWS_PER_RANDOM; k++) {
+		powers[k] = powers[k - 1] * INFLATION_PERSISTENCE;
+	}
+	return powers;
+}();
+
+void generateInflationPath(InflationPath& path, ScenarioRng& generator,
+                           const std::array<float, MAX_YEARS>* market) {
+	const float* table = normalQuantiles().data();
+
+	/* Independent unit shocks, DRAWS_PER_RANDOM per random draw */
+	std::array<float, MAX_YEARS> shock;
+	for (unsigned int n = 0; n < MAX_YEARS; n += DRAWS_PER_RANDOM) {
+		uint64_t bits = generator();
+		for (unsigned int k = 0; k < DRAWS_PER_RANDOM; k++) {
+			shock[n + k] = table[(bits >> (k * NORMAL_TABLE_BITS)) & (NORMAL_TABLE_SIZE - 1)];
+		}
+	}
+
+	/* Mix in the standardized market return of each year */
+	if (market != nullptr) {
+		const float own = std::sqrt(1.0f - INFLATION_MARKET_CORRELATION * INFLATION_MARKET_CORRELATION);
+		const float link = INFLATION_MARKET_CORRELATION / STOCK_VOLATILITY;
+		for (int n = 0; n < MAX_YEARS; n++) {
+			shock[n] = own * shock[n] + link * ((*market)[n] - STOCK_GROWTH_AVG);
+		}
+	}
+
+	/* The recursions are run a block of DRAWS_PER_RANDOM years at a time:
+	 * within a block, from the block's own shocks only, which does not
+	 * wait on the previous blocks; then the deviation and growth carried
+	 * in from the previous block are added in with one step each. This
+	 * keeps the chain from year to year short. */
+	float carried = 0.0f;
+	float growth = 1.0f;
+	for (unsigned int n = 0; n < MAX_YEARS; n += DRAWS_PER_RANDOM) {
+		float own[DRAWS_PER_RANDOM];
+		float running = 0.0f;
+		for (unsigned int k = 0; k < DRAWS_PER_RANDOM; k++) {
+			running = INFLATION_PERSISTENCE * running + INFLATION_VOLATILITY * shock[n + k];
+			own[k] = running;
+		}
+
+		float product = 1.0f;
+		for (unsigned int k = 0; k < DRAWS_PER_RANDOM; k++) {
+			float deviation = own[k] + persistencePowers[k + 1] * carried;
+			path.deviation[n + k] = deviation;
+			path.growth[n + k] = growth * product;
+			product *= 1 + deviation;
+		}
+		carried = path.deviation[n + DRAWS_PER_RANDOM - 1];
+		growth *= product;
+	}
+}
@@ -0,0 +1,114 @@
+/* ============================================================================
+ * modelMortality.cpp
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Implements the loading of the life table and the tabulation of the
+ *  remaining years of life by sex and age.
+ *
+ *  Dependencies:
+ *    - modelMortality.h
+ *    - userDataLoading.h (parsing helpers)
+ *    - profileBinary.h (checksum)
+ *
+ *  Created:    October 2026
+ *  Author:     Yuping X
+ * ============================================================================
+ */
+
+#include <fstream>
+#include <array>
+#include <stdexcept>
+#include "../include/modelMortality.h"
+#include "../include/userDataLoading.h"
+#include "../include/profileBinary.h"
+
+LifeTable::LifeTable(const std::string& filename)
+	: checksum_(0)
+{
+	std::ifstream file(filename);
+	if (!file.is_open()) {
+		throw std::runtime_error("Could not open life table " + filename);
+	}
+
+	/* Death probability of each sex at each age; the unknown sex averages
+	 * the other two */
+	std::vector<std::array<float, LIFE_TABLE_SEXES>> death;
+	std::string line;
+	size_t lineNum = 0;
+	bool headerSeen = false;
+	while (std::getline(file, line)) {
+		lineNum++;
+		std::string_view row = trim(line);
+		if (row.empty() || (row.front() == '#')) {
+			continue;
+		}
+		if (!headerSeen) {
+			headerSeen = true;
+			if (row != "Age,Male,Female") {
+				throw std::runtime_error(filename + ": expected the header Age,Male,Female");
+			}
+			continue;
+		}
+
+		std::vector<std::string_view> fields = splitList(row);
+		unsigned int age = 0;
+		std::array<float, LIFE_TABLE_SEXES> q = {0.0f, 0.0f, 0.0f};
+		if ((fields.size() != 3) || \
+		    (parseNumber(fields[0], age) != std::errc()) || (age != death.size()) || \
+		    (parseNumber(fields[1], q[SEX_MALE]) != std::errc()) || \
+		    (parseNumber(fields[2], q[SEX_FEMALE]) != std::errc()) || \
+		    !((q[SEX_MALE] >= 0) && (q[SEX_MALE] <= 1)) || \
+		    !((q[SEX_FEMALE] >= 0) && (q[SEX_FEMALE] <= 1))) {
+			throw std::runtime_error(filename + ":" + std::to_string(lineNum) + ": malformed row");
+		}
+		q[SEX_UNKNOWN] = 0.5f * (q[SEX_MALE] + q[SEX_FEMALE]);
+		death.push_back(q);
+	}
+
+	if (death.size() != LIFE_TABLE_AGES) {
+		throw std::runtime_error(filename + " must hold the ages 0 to " + \
+		                         std::to_string(LIFE_TABLE_AGES - 1));
+	}
+	checksum_ = profileChecksum(death.data(), death.size() * sizeof(death[0]));
+
+	/* Invert the distribution of the year of death of every sex and age
+	 * at the midpoints of the quantile steps. Nobody outlives the last age
+	 * of the table, whatever its probability. */
+	yearsLeft_.resize(LIFE_TABLE_SEXES * LIFE_TABLE_AGES * MORTALITY_TABLE_SIZE);
+	for (unsigned int sex = 0; sex < LIFE_TABLE_SEXES; sex++) {
+		for (unsigned int age = 0; age < LIFE_TABLE_AGES; age++) {
+			uint8_t* years = yearsLeft_.data() + (size_t(sex) * LIFE_TABLE_AGES + age) * MORTALITY_TABLE_SIZE;
+			unsigned int k = 0;
+			double survival = 1.0 - death[age][sex];
+			for (unsigned int j = 0; j < MORTALITY_TABLE_SIZE; j++) {
+				double quantile = (j + 0.5) / MORTALITY_TABLE_SIZE;
+				while ((1.0 - survival <= quantile) && (age + k + 1 < LIFE_TABLE_AGES)) {
+					k++;
+					survival *= 1.0 - death[age + k][sex];
+				}
+				years[j] = static_cast<uint8_t>(k);
+			}
+		}
+	}
+}
+
+const LifeTable& LifeTable::shared()
+{
+	static const LifeTable table(LIFE_TABLE_FILE);
+	return table;
+}
+
+uint64_t LifeTable::checksum() const
+{
+	return checksum_;
+}
+
+const uint8_t* profileLifeQuantiles(const UserData& user, const LifeTable& table)
+{
+	if ((user.birthYear == 0) || (user.birthYear > CURRENT_YEAR)) {
+		return nullptr;
+	}
+	unsigned int sex = (user.sex < LIFE_TABLE_SEXES) ? user.sex : SEX_UNKNOWN;
+	return table.quantiles(sex, CURRENT_YEAR - user.birthYear);
+}
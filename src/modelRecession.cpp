@@ -8,12 +8,11 @@
  *  populate growth rate curves applied to investment assets.
  *
  *  Functions:
- *    - scenarioPredefinedYear0Loss: Hardcoded recession scenario where year-0
- * 		is a recession year.
- *    - scenarioRandom1: Randomly inserts recessions and recoveries with randomness
- *      in timing and severity.
+ *    - scenarioRecessionRandomized / generateRecessionRandomized: Randomly
+ *      inserts recessions and recoveries with randomness in timing and severity.
  *    - populateGrowthCurves: Fills out asset-specific growth curves based on
- *      selected profile and average expected return.
+ *      selected profile (or a given common curve) and average expected return,
+ *      or sets them to given per-account curves.
  *
  *  Dependencies:
  *    - asset.h
@@ -29,23 +28,23 @@
 #include <iostream>
 #include <random>
 #include <chrono>
+#include "../include/scenarioRng.h"
 #include "../include/asset.h"
 #include "../include/modelRecession.h"
 #include "../include/constants.h"
 
-/* =========================================================================
- * Scenario Definition: A Predefined Worst-case
- * ========================================================================= */
-void Asset::scenarioPredefinedYear0Loss(std::array<float, MAX_YEARS>& growth_common) {
-	for (int n = 0; n < growth_common.size(); n++) {
-		growth_common[n] = RECESSION_YEAR0_LOSS[n];
-	}
-}
-
 /* =========================================================================
  * Scenario Definition: Randomized based on Predefined Recession Assumptions
  * ========================================================================= */
 void Asset::scenarioRecessionRandomized(std::array<float, MAX_YEARS>& growth_common) {
+    /* Get a time-based seed using high-resolution clock */
+    auto seed = std::chrono::system_clock::now().time_since_epoch().count();
+    ScenarioRng generator(seed, 0);
+
+    generateRecessionRandomized(growth_common, generator);
+}
+
+void generateRecessionRandomized(std::array<float, MAX_YEARS>& growth_common, ScenarioRng& generator) {
 	/* In this profile we assume the first recession year happens in the
 	 * next RECESSION_START_MOD years;
 	 * Initialize the temporary growth curve to 0's.
@@ -60,14 +59,9 @@ void Asset::scenarioRecessionRandomized(std::array<float, MAX_YEARS>& growth_com
 		growth_common[n] = 0;
 	}
 
-    /* Get a time-based seed using high-resolution clock,
-	 * then create, seed, and use the random number generator
-	 * for uniformely distributed random integers between 1 and 100
+    /* Use the given random number generator for uniformely distributed
+	 * random integers between 1 and 100
 	 */
-    auto seed = std::chrono::system_clock::now().time_since_epoch().count();
-
-    std::mt19937 generator(seed);
-
     std::uniform_int_distribution<int> distribution(RANDOM_NUM_MIN, RANDOM_NUM_MAX);
 
 	/* Generate the recession start year */
@@ -152,30 +146,63 @@ void Asset::populateGrowthCurves(const ModelOption option) {
 			break;
 
 		case ModelOption::PREDEFINED_YEAR0_LOSS:
-			Asset::scenarioPredefinedYear0Loss(growth_common);
-			break;
+			/* A predefined worst case: the hardcoded curve, scaled directly */
+			populateGrowthCurves(RECESSION_YEAR0_LOSS);
+			return;
 
 		case ModelOption::RECESSION_RANDOMIZED:
 			Asset::scenarioRecessionRandomized(growth_common);
 			break;
 
+		case ModelOption::HISTORICAL_BOOTSTRAP:
+			Asset::scenarioHistoricalBootstrap(growth_common);
+			break;
+
+		case ModelOption::REGIME_SWITCHING:
+			Asset::scenarioRegimeSwitching(growth_common);
+			break;
+
+		case ModelOption::CORRELATED_ACCOUNTS:
+			/* Sets every account's curve itself */
+			Asset::scenarioCorrelatedAccounts();
+			return;
+
 		default:
 			std::cerr << "ERROR: Fund growth moodel option not recognized!" << std::endl;
 
 	}
 	if (option != ModelOption::CONSTANT) {
-		/* Unless using the "constant" model, we have a last step:
-		 * We populate the growth curves for each investment item.
-		 * We guess a ratio of the stock in the investment, and multiply the generic growth curve
-		 * generated above with this approximate ratio.
-		 */
-		for (int c = 0; c < MAX_ACCOUNTS; c++) {
-			float guessed_stock_ratio = Asset::growthRateAvg_[c] / STOCK_GROWTH_AVG;
-			/* Ensure the ratio is 1.0 at maximum */
-			guessed_stock_ratio = (guessed_stock_ratio <= 1.0)? guessed_stock_ratio : 1.0;
-			for (int n = 0; n < growth_common.size(); n++) {
-				Asset::growthRate_[c][n] = growth_common[n] * guessed_stock_ratio;
-			}
+		/* Unless using the "constant" model, we have a last step */
+		populateGrowthCurves(growth_common);
+	}
+}
+
+std::array<float, MAX_ACCOUNTS> Asset::stockRatios() const {
+	/* We guess a ratio of the stock in each investment from its average
+	 * growth, at most 1.0 */
+	std::array<float, MAX_ACCOUNTS> guessed_stock_ratio;
+	for (int c = 0; c < MAX_ACCOUNTS; c++) {
+		guessed_stock_ratio[c] = std::min(Asset::growthRateAvg_[c] / STOCK_GROWTH_AVG, 1.0f);
+	}
+	return guessed_stock_ratio;
+}
+
+void Asset::populateGrowthCurves(const std::array<float, MAX_YEARS>& growth_common) {
+	populateGrowthCurves(growth_common, stockRatios());
+}
+
+void Asset::populateGrowthCurves(const std::array<float, MAX_YEARS>& growth_common,
+                                 const std::array<float, MAX_ACCOUNTS>& stock_ratio) {
+	/* We populate the growth curves for each investment item by multiplying
+	 * the generic growth curve with the account's stock ratio, in one pass
+	 * straight into the simulator's layout */
+	for (int c = 0; c < MAX_ACCOUNTS; c++) {
+		for (int n = 0; n < MAX_YEARS; n++) {
+			Asset::growthRate_[c][n] = growth_common[n] * stock_ratio[c];
 		}
 	}
 }
+
+void Asset::populateGrowthCurves(const AccountCurves& growth) {
+	Asset::growthRate_ = growth;
+}
@@ -0,0 +1,252 @@
+/* ============================================================================
+ * modelRegime.cpp
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Implements the Markov regime-switching growth model and the loading of
+ *  its model file.
+ *
+ *  Dependencies:
+ *    - modelRegime.h
+ *    - aliasTable.h
+ *    - asset.h
+ *    - userDataLoading.h (parsing helpers)
+ *    - profileBinary.h (checksum)
+ *
+ *  Created:    October 2026
+ *  Author:     Yuping X
+ * ============================================================================
+ */
+
+#include <fstream>
+#include <chrono>
+#include <cmath>
+#include <map>
+#include <stdexcept>
+#include "../include/modelRegime.h"
+#include "../include/aliasTable.h"
+#include "../include/asset.h"
+#include "../include/userDataLoading.h"
+#include "../include/profileBinary.h"
+
+/* Number of chain steps used to reach the stationary distribution */
+static const unsigned int REGIME_STATIONARY_STEPS = 1000;
+
+RegimeModel::RegimeModel(const std::string& filename)
+	: checksum_(0)
+{
+	std::ifstream file(filename);
+	if (!file.is_open()) {
+		throw std::runtime_error("Could not open regime model " + filename);
+	}
+
+	/* Read all Key = value lines */
+	std::map<std::string, std::string> values;
+	std::string line;
+	size_t lineNum = 0;
+	while (std::getline(file, line)) {
+		lineNum++;
+		std::string_view row = trim(line);
+		if (row.empty() || (row.front() == '#')) {
+			continue;
+		}
+		size_t equals = row.find('=');
+		if (equals == std::string_view::npos) {
+			throw std::runtime_error(filename + ":" + std::to_string(lineNum) + ": expected Key = value");
+		}
+		values[std::string(trim(row.substr(0, equals)))] = std::string(trim(row.substr(equals + 1)));
+	}
+
+	auto lookup = [&](const std::string& key) -> const std::string& {
+		auto it = values.find(key);
+		if (it == values.end()) {
+			throw std::runtime_error(filename + ": missing " + key);
+		}
+		return it->second;
+	};
+
+	std::array<std::array<double, REGIME_COUNT>, REGIME_COUNT> transition;
+	std::array<std::vector<std::pair<float, double>>, REGIME_COUNT> returns;
+	std::vector<double> parameters;
+
+	for (unsigned int r = 0; r < REGIME_COUNT; r++) {
+		/* Transition row */
+		std::string key = REGIME_NAMES[r] + "-next";
+		std::vector<std::string_view> fields = splitList(lookup(key));
+		if (fields.size() != REGIME_COUNT) {
+			throw std::runtime_error(filename + ": " + key + " must list " + \
+			                         std::to_string(REGIME_COUNT) + " probabilities");
+		}
+		double rowSum = 0;
+		for (unsigned int j = 0; j < REGIME_COUNT; j++) {
+			if ((parseNumber(fields[j], transition[r][j]) != std::errc()) || (transition[r][j] < 0)) {
+				throw std::runtime_error(filename + ": invalid probability in " + key);
+			}
+			rowSum += transition[r][j];
+			parameters.push_back(transition[r][j]);
+		}
+		if (std::fabs(rowSum - 1.0) > REGIME_ROW_TOLERANCE) {
+			throw std::runtime_error(filename + ": " + key + " must sum to 1");
+		}
+
+		/* Return distribution */
+		key = REGIME_NAMES[r] + "-returns";
+		double weightSum = 0;
+		for (std::string_view field : splitList(lookup(key))) {
+			size_t colon = field.find(':');
+			float rate = 0;
+			double weight = 0;
+			if ((colon == std::string_view::npos) || \
+			    (parseNumber(trim(field.substr(0, colon)), rate) != std::errc()) || \
+			    (parseNumber(trim(field.substr(colon + 1)), weight) != std::errc()) || \
+			    (rate <= -1.0f) || (weight < 0)) {
+				throw std::runtime_error(filename + ": invalid return:weight pair in " + key);
+			}
+			if (returns[r].size() == REGIME_MAX_RETURNS) {
+				throw std::runtime_error(filename + ": " + key + " lists more than " + \
+				                         std::to_string(REGIME_MAX_RETURNS) + " returns");
+			}
+			returns[r].emplace_back(rate, weight);
+			weightSum += weight;
+			parameters.push_back(rate);
+			parameters.push_back(weight);
+		}
+		if (weightSum <= 0) {
+			throw std::runtime_error(filename + ": " + key + " has no positive weight");
+		}
+		for (auto& pair : returns[r]) {
+			pair.second /= weightSum;
+		}
+	}
+	checksum_ = profileChecksum(parameters.data(), parameters.size() * sizeof(double));
+
+	/* An outcome of two years: their returns and the regime entered */
+	struct TwoYears {
+		float rate[2];
+		uint32_t regime;
+	};
+
+	/* Lists the joint outcomes of two years, given the distribution of the
+	 * first year's regime */
+	auto jointOutcomes = [&](const std::array<double, REGIME_COUNT>& first,
+	                         std::vector<double>& weights, std::vector<TwoYears>& outcomes) {
+		for (unsigned int j1 = 0; j1 < REGIME_COUNT; j1++) {
+			for (const auto& [rate1, weight1] : returns[j1]) {
+				for (unsigned int j2 = 0; j2 < REGIME_COUNT; j2++) {
+					for (const auto& [rate2, weight2] : returns[j2]) {
+						double weight = first[j1] * weight1 * transition[j1][j2] * weight2;
+						if (weight > 0) {
+							weights.push_back(weight);
+							outcomes.push_back({{rate1, rate2}, j2});
+						}
+					}
+				}
+			}
+		}
+	};
+
+	/* Every table has a column per pair of returns, at most */
+	size_t outcomeCount = 0;
+	for (unsigned int r = 0; r < REGIME_COUNT; r++) {
+		outcomeCount += returns[r].size();
+	}
+	outcomeCount *= outcomeCount;
+	columnBits_ = 0;
+	while ((size_t(1) << columnBits_) < outcomeCount) {
+		columnBits_++;
+	}
+	columns_.reserve((REGIME_COUNT + 1) << columnBits_);
+
+	/* Appends the padded, fused table of a first-year regime distribution */
+	auto buildJoint = [&](const std::array<double, REGIME_COUNT>& first) {
+		std::vector<double> weights;
+		std::vector<TwoYears> outcomes;
+		jointOutcomes(first, weights, outcomes);
+		weights.resize(size_t(1) << columnBits_, 0.0);
+		outcomes.resize(weights.size(), outcomes.front());
+
+		AliasTable table(weights);
+		for (uint32_t c = 0; c < table.size(); c++) {
+			const TwoYears& keep = outcomes[c];
+			const TwoYears& alias = outcomes[table.alias(c)];
+			columns_.push_back({table.threshold(c),
+			                    {keep.regime << columnBits_, alias.regime << columnBits_},
+			                    {{keep.rate[0], keep.rate[1]}, {alias.rate[0], alias.rate[1]}}, 0});
+		}
+	};
+
+	for (unsigned int r = 0; r < REGIME_COUNT; r++) {
+		buildJoint(transition[r]);
+	}
+
+	/* Stationary distribution, by running the chain from uniform */
+	std::array<double, REGIME_COUNT> stationary;
+	stationary.fill(1.0 / REGIME_COUNT);
+	for (unsigned int step = 0; step < REGIME_STATIONARY_STEPS; step++) {
+		std::array<double, REGIME_COUNT> next{};
+		for (unsigned int r = 0; r < REGIME_COUNT; r++) {
+			for (unsigned int j = 0; j < REGIME_COUNT; j++) {
+				next[j] += stationary[r] * transition[r][j];
+			}
+		}
+		stationary = next;
+	}
+	buildJoint(stationary);
+}
+
+const RegimeModel& RegimeModel::shared()
+{
+	static const RegimeModel model(REGIME_MODEL_FILE);
+	return model;
+}
+
+uint64_t RegimeModel::checksum() const
+{
+	return checksum_;
+}
+
+void RegimeModel::generate(std::array<float, MAX_YEARS>& growth_common, ScenarioRng& generator) const
+{
+	/* 32 random bits per two years pick both years' returns and the regime
+	 * entered: the top columnBits_ pick the column of the current table,
+	 * the rest whether it keeps its own outcome. A 64-bit draw serves four
+	 * years */
+	const Column* columns = columns_.data();
+	const unsigned int columnBits = columnBits_;
+	uint32_t table = INITIAL_TABLE << columnBits;
+	auto step = [&](uint32_t bits, unsigned int n) {
+		uint32_t column = static_cast<uint32_t>((uint64_t(bits) << columnBits) >> 32);
+		const Column& entry = columns[table + column];
+		uint32_t keep = 0u - static_cast<uint32_t>((bits << columnBits) < entry.threshold);
+		table = (entry.next[0] & keep) | (entry.next[1] & ~keep);
+		const float* rate = entry.rate[keep & 1u ? 0 : 1];
+		growth_common[n] = rate[0];
+		if (n + 1 < MAX_YEARS) {
+			growth_common[n + 1] = rate[1];
+		}
+	};
+
+	for (unsigned int n = 0; n < MAX_YEARS; n += 4) {
+		uint64_t bits = generator();
+		step(static_cast<uint32_t>(bits >> 32), n);
+		if (n + 2 < MAX_YEARS) {
+			step(static_cast<uint32_t>(bits), n + 2);
+		}
+	}
+}
+
+/* =========================================================================
+ * Scenario Definition: Markov Regime Switching
+ * ========================================================================= */
+void Asset::scenarioRegimeSwitching(std::array<float, MAX_YEARS>& growth_common) {
+	/* Get a time-based seed using high-resolution clock */
+	auto seed = std::chrono::system_clock::now().time_since_epoch().count();
+	ScenarioRng generator(seed, 0);
+
+	generateRegimeSwitching(growth_common, generator, RegimeModel::shared());
+}
+
+void generateRegimeSwitching(std::array<float, MAX_YEARS>& growth_common, ScenarioRng& generator,
+                             const RegimeModel& model) {
+	model.generate(growth_common, generator);
+}
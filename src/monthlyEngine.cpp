@@ -0,0 +1,297 @@
+/* ============================================================================
+ * monthlyEngine.cpp
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Implements the monthly time-step engine: the intra-year bridges, the
+ *  monthly cash flows, and the monthly simulation of an Asset.
+ *
+ *  Dependencies:
+ *    - monthlyEngine.h
+ *    - asset.h
+ *    - modelCorrelated.h (normal quantiles)
+ *    - taxModel.h
+ *
+ *  Created:    October 2026
+ *  Author:     Yuping X
+ * ============================================================================
+ */
+
+#include <iostream>
+#include <cmath>
+#include <algorithm>
+#include "../include/monthlyEngine.h"
+#include "../include/asset.h"
+#include "../include/modelCorrelated.h"
+#include "../include/taxModel.h"
+
+/* Number of unit draws taken from one 64-bit random draw */
+static const unsigned int DRAWS_PER_RANDOM = 64 / NORMAL_TABLE_BITS;
+
+/* Share of the year elapsed at the start of each month */
+static constexpr std::array<float, MONTHS_PER_YEAR> MONTH_FRACTION = [] {
+	std::array<float, MONTHS_PER_YEAR> fraction = {};
+	for (unsigned int k = 0; k < MONTHS_PER_YEAR; k++) {
+		fraction[k] = float(k) / MONTHS_PER_YEAR;
+	}
+	return fraction;
+}();
+
+void generateMonthlyBridge(MonthlyBridge& bridge, ScenarioRng& generator)
+{
+	const float* table = normalQuantiles().data();
+	const float step = 1.0f / std::sqrt(float(MONTHS_PER_YEAR));
+
+	/* Monthly steps of a random walk with a yearly standard deviation of 1 */
+	uint64_t bits = 0;
+	unsigned int left = 0;
+	for (unsigned int m = 0; m < MAX_MONTHS; m++) {
+		if (left == 0) {
+			bits = generator();
+			left = DRAWS_PER_RANDOM;
+		}
+		bridge[m] = step * table[bits & (NORMAL_TABLE_SIZE - 1)];
+		bits >>= NORMAL_TABLE_BITS;
+		left--;
+	}
+
+	/* Tie each year's walk down at both ends: the walk at the start of
+	 * month k, less k/12 of the walk over the year, within the limits */
+	for (unsigned int n = 0; n < MAX_YEARS; n++) {
+		float* year = bridge.data() + n * MONTHS_PER_YEAR;
+		std::array<float, MONTHS_PER_YEAR> walk;
+		float position = 0.0f;
+		for (unsigned int k = 0; k < MONTHS_PER_YEAR; k++) {
+			walk[k] = position;
+			position += year[k];
+		}
+		for (unsigned int k = 0; k < MONTHS_PER_YEAR; k++) {
+			year[k] = std::clamp(walk[k] - MONTH_FRACTION[k] * position,
+			                     -MONTHLY_BRIDGE_LIMIT, MONTHLY_BRIDGE_LIMIT);
+		}
+	}
+}
+
+void MonthlySchedule::initializeFromSchedule(const ProfileSchedule& schedule)
+{
+	const float month = 1.0f / MONTHS_PER_YEAR;
+
+	for (int c = 0; c < MAX_ACCOUNTS; c++) {
+		initialValue_[c] = static_cast<float>(schedule.initialValue_[c]);
+	}
+
+	for (int n = 0; n < MAX_YEARS; n++) {
+		float expense = schedule.netExpense_[n] * month;
+		std::fill_n(netExpense_.begin() + n * MONTHS_PER_YEAR, MONTHS_PER_YEAR, expense);
+		distributes_[n] = (schedule.netExpense_[n] > 0);
+
+		contributes_[n] = false;
+		contributesToAvailable_[n] = false;
+		for (int c = 0; c < MAX_ACCOUNTS; c++) {
+			float contribution = schedule.contribution_[c][n] * month;
+			std::fill_n(contribution_[c].begin() + n * MONTHS_PER_YEAR, MONTHS_PER_YEAR, contribution);
+			available_[n][c] = schedule.availability_[c][n] ? 1.0f : 0.0f;
+
+			bool contributing = (schedule.contribution_[c][n] > 0);
+			contributes_[n] = contributes_[n] || contributing;
+			contributesToAvailable_[n] = contributesToAvailable_[n] || \
+			                             (contributing && schedule.availability_[c][n]);
+		}
+
+		pension_[n] = static_cast<float>(schedule.pension_[n]);
+		rmdRate_[n] = schedule.rmdRate_[n];
+		priceLevel_[n] = schedule.priceLevel_[n];
+	}
+}
+
+/* Bridge of the deterministic models, which grow along the straight line */
+static const std::array<float, MONTHS_PER_YEAR> NO_WALK = {};
+
+/**
+ * @brief Gets the level of an account at the start of a month of a year.
+ */
+static inline float monthLevel(float growth, float volatility, const float* walk, unsigned int k)
+{
+	return 1.0f + growth * MONTH_FRACTION[k] + volatility * walk[k];
+}
+
+void Asset::calculateMonthlyN(const MonthlySchedule& schedule, const MonthlyBridge* bridge,
+                              const TaxTable* tax, int horizon)
+{
+	/* Yearly volatility of each account, from its covariance factor */
+	std::array<float, MAX_ACCOUNTS> accountVolatility;
+	for (int c = 0; c < MAX_ACCOUNTS; c++) {
+		float variance = 0.0f;
+		for (int k = 0; k < MAX_ACCOUNTS; k++) {
+			variance += returnFactor_.lower[c][k] * returnFactor_.lower[c][k];
+		}
+		accountVolatility[c] = std::sqrt(variance);
+	}
+
+	std::array<float, MAX_ACCOUNTS> value = schedule.initialValue_;
+	float basis = value[INDIVIDUAL_INDEX];
+	float taxDue = 0.0f;
+
+	int n;
+	for (n = 0; n < horizon; n++) {
+		const unsigned int first = n * MONTHS_PER_YEAR;
+		const std::array<float, MAX_ACCOUNTS>& available = schedule.available_[n];
+		const float* walk = (bridge != nullptr) ? bridge->data() + first : NO_WALK.data();
+		const float taxMonthly = taxDue / MONTHS_PER_YEAR;
+
+		/* Growth of each account over the year, and its volatility, scaled
+		 * down in the years it would take the account below the floor */
+		std::array<float, MAX_ACCOUNTS> rate;
+		std::array<float, MAX_ACCOUNTS> growth;
+		std::array<float, MAX_ACCOUNTS> volatility;
+		for (int c = 0; c < MAX_ACCOUNTS; c++) {
+			rate[c] = growthRate_[c][n];
+			const float limit = (1.0f - MONTHLY_MIN_LEVEL) * (1.0f + std::min(rate[c], 0.0f));
+			growth[c] = 1.0f + rate[c];
+			volatility[c] = std::min(accountVolatility[c], limit * (1.0f / MONTHLY_BRIDGE_LIMIT));
+			value_[c][n] = static_cast<long int>(value[c]);
+		}
+
+		std::array<float, MAX_ACCOUNTS> distributed = {};
+		float soldBasis = 0.0f;
+		bool covered = true;
+
+		if (!schedule.distributes_[n] && (taxDue == 0.0f)) {
+			/* Nothing to distribute: every account grows over the year */
+			for (int c = 0; c < MAX_ACCOUNTS; c++) {
+				value[c] *= growth[c];
+			}
+		}
+		else if (!schedule.contributesToAvailable_[n]) {
+			/* Closed form: the levels are linear in the growth and the
+			 * volatility, so the total of the available accounts in each
+			 * month, were nothing distributed, comes from three sums */
+			float start = 0.0f, trend = 0.0f, swing = 0.0f;
+			for (int c = 0; c < MAX_ACCOUNTS; c++) {
+				const float held = available[c] * value[c];
+				start += held;
+				trend += held * rate[c];
+				swing += held * volatility[c];
+			}
+
+			/* Share of that total each month's expense takes */
+			std::array<float, MONTHS_PER_YEAR> share;
+			const float* expense = schedule.netExpense_.data() + first;
+			for (unsigned int k = 0; k < MONTHS_PER_YEAR; k++) {
+				share[k] = (expense[k] + taxMonthly) / \
+				           (start + trend * MONTH_FRACTION[k] + swing * walk[k]);
+			}
+
+			/* The months the running sum of the shares stays at most 1 in
+			 * are covered */
+			float taken = 0.0f;
+			unsigned int months = 0;
+			float trendShare = 0.0f, swingShare = 0.0f;
+			for (unsigned int k = 0; k < MONTHS_PER_YEAR; k++) {
+				taken += share[k];
+				months += (taken <= 1.0f);
+				trendShare += MONTH_FRACTION[k] * share[k];
+				swingShare += walk[k] * share[k];
+			}
+			covered = (months == MONTHS_PER_YEAR);
+
+			/* Each available account gives the share of the month of its
+			 * value in the month, and keeps the rest */
+			for (int c = 0; c < MAX_ACCOUNTS; c++) {
+				const float given = taken + rate[c] * trendShare + volatility[c] * swingShare;
+				distributed[c] = available[c] * value[c] * given;
+				value[c] *= growth[c] * (1.0f - available[c] * taken);
+			}
+			soldBasis = basis * taken;
+			basis -= soldBasis;
+		}
+		else {
+			/* Contributions to accounts distributed from: month by month */
+			std::array<float, MAX_ACCOUNTS> level;
+			for (int c = 0; c < MAX_ACCOUNTS; c++) {
+				level[c] = 1.0f;
+			}
+			for (unsigned int k = 0; k < MONTHS_PER_YEAR; k++) {
+				float total = 0.0f;
+				for (int c = 0; c < MAX_ACCOUNTS; c++) {
+					total += available[c] * value[c];
+				}
+				const float expense = schedule.netExpense_[first + k] + taxMonthly;
+				if (expense > total) {
+					covered = false;
+					break;
+				}
+				const float part = expense / total;
+				for (int c = 0; c < MAX_ACCOUNTS; c++) {
+					const float given = available[c] * value[c] * part;
+					const float next = (k + 1 < MONTHS_PER_YEAR) ? \
+					                   monthLevel(rate[c], volatility[c], walk, k + 1) : growth[c];
+					distributed[c] += given;
+					value[c] = (value[c] - given) * next / level[c] + schedule.contribution_[c][first + k];
+					level[c] = next;
+				}
+				soldBasis += basis * part;
+				basis = basis * (1 - part) + schedule.contribution_[INDIVIDUAL_INDEX][first + k];
+			}
+		}
+
+		if (!covered) {
+			break;
+		}
+
+		/* Contributions of the year, unless stepped through above */
+		if (schedule.contributes_[n] && \
+		    !(schedule.contributesToAvailable_[n] && (schedule.distributes_[n] || (taxDue > 0.0f)))) {
+			/* The contribution at the end of month k grows from the level of
+			 * the start of month k + 1 to the end of the year; all accounts
+			 * at once */
+			std::array<float, MAX_ACCOUNTS> grown = {};
+			for (unsigned int k = 0; k + 1 < MONTHS_PER_YEAR; k++) {
+				for (int c = 0; c < MAX_ACCOUNTS; c++) {
+					grown[c] += schedule.contribution_[c][first + k] / \
+					            monthLevel(rate[c], volatility[c], walk, k + 1);
+				}
+			}
+			for (int c = 0; c < MAX_ACCOUNTS; c++) {
+				value[c] += schedule.contribution_[c][first + MONTHS_PER_YEAR - 1] + growth[c] * grown[c];
+			}
+			for (unsigned int k = 0; k < MONTHS_PER_YEAR; k++) {
+				basis += schedule.contribution_[INDIVIDUAL_INDEX][first + k];
+			}
+		}
+
+		/* Required distributions not reached by the year's distributions
+		 * are topped up at the end of the year into the individual account */
+		if (schedule.rmdRate_[n] > 0.0f) {
+			for (int c : {IRA_INDEX, R401K_INDEX}) {
+				float required = value_[c][n] * schedule.rmdRate_[n];
+				float forced = std::min(std::max(required - distributed[c], 0.0f), value[c]);
+				distributed[c] += forced;
+				value[c] -= forced;
+				value[INDIVIDUAL_INDEX] += forced;
+				basis += forced;
+			}
+		}
+
+		for (int c = 0; c < MAX_ACCOUNTS; c++) {
+			distribution_[c][n] = static_cast<long int>(distributed[c]);
+		}
+
+		if (tax != nullptr) {
+			/* As in calculateN(), in year-0 dollars */
+			float gains = std::max(distributed[INDIVIDUAL_INDEX] - soldBasis, 0.0f);
+			float ordinary = schedule.pension_[n] + distributed[IRA_INDEX] + distributed[R401K_INDEX];
+			float level = schedule.priceLevel_[n];
+			float deflator = 1.0f / level;
+			taxDue = level * tax->tax(ordinary * deflator, gains * deflator);
+		}
+	}
+
+	fundLongevity_ = n;
+
+	if (DEBUG_PRINT)
+	{
+		std::cout << "DEBUG: CONCLUSION: Fund will last " \
+		          << fundLongevity_ << " years (monthly steps). " << '\n';
+	}
+}
@@ -0,0 +1,397 @@
+/* ============================================================================
+ * ndjsonStream.cpp
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Implements the NDJSON streaming pipeline. The calling thread reads lines
+ *  into a fixed window of slots and submits each to the thread pool, a
+ *  writer thread emits the finished slots in input order, and the window
+ *  bounds the number of lines in flight.
+ *
+ *  Dependencies:
+ *    - ndjsonStream.h
+ *    - householdBook.h
+ *    - userDataLoading.h
+ *
+ *  Created:    October 2026
+ *  Author:     Yuping X
+ * ============================================================================
+ */
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <stdexcept>
+#include <charconv>
+#include <chrono>
+#include <type_traits>
+#include "../include/ndjsonStream.h"
+#include "../include/householdBook.h"
+#include "../include/userDataLoading.h"
+#include "../include/constants.h"
+
+/* Skips blanks at the beginning of text */
+static void skipBlanks(std::string_view& text) {
+	size_t start = text.find_first_not_of(" \t\r\n");
+	text.remove_prefix((start == std::string_view::npos) ? text.size() : start);
+}
+
+/* Reads a JSON string at the beginning of text, which starts at the opening
+ * quote. Only the escapes \" \\ \/ \b \f \n \r \t are supported. */
+static std::string readString(std::string_view& text) {
+	std::string value;
+	size_t i = 1;
+	for (; (i < text.size()) && (text[i] != '"'); i++) {
+		if (text[i] != '\\') {
+			value += text[i];
+			continue;
+		}
+		if (++i == text.size()) {
+			break;
+		}
+		switch (text[i]) {
+			case '"':  value += '"'; break;
+			case '\\': value += '\\'; break;
+			case '/':  value += '/'; break;
+			case 'b':  value += '\b'; break;
+			case 'f':  value += '\f'; break;
+			case 'n':  value += '\n'; break;
+			case 'r':  value += '\r'; break;
+			case 't':  value += '\t'; break;
+			default:
+				throw std::runtime_error("Unsupported escape in string: \\" + std::string(1, text[i]));
+		}
+	}
+	if (i >= text.size()) {
+		throw std::runtime_error("Unterminated string");
+	}
+	text.remove_prefix(i + 1);
+	return value;
+}
+
+/* Appends a JSON string to out */
+static void appendString(std::string& out, std::string_view value) {
+	out += '"';
+	for (char ch : value) {
+		switch (ch) {
+			case '"':  out += "\\\""; break;
+			case '\\': out += "\\\\"; break;
+			case '\n': out += "\\n"; break;
+			case '\r': out += "\\r"; break;
+			case '\t': out += "\\t"; break;
+			default:
+				if (static_cast<unsigned char>(ch) < 0x20) {
+					out += ' ';
+				}
+				else {
+					out += ch;
+				}
+		}
+	}
+	out += '"';
+}
+
+/* Appends a number to out; floating-point numbers get 4 decimals */
+template <typename T>
+static void appendNumber(std::string& out, T value) {
+	char buffer[32];
+	std::to_chars_result written;
+	if constexpr (std::is_floating_point_v<T>) {
+		written = std::to_chars(buffer, buffer + sizeof(buffer), value, std::chars_format::fixed, 4);
+	}
+	else {
+		written = std::to_chars(buffer, buffer + sizeof(buffer), value);
+	}
+	out.append(buffer, written.ptr);
+}
+
+/* Number of profile keys: account values and rates, and [General] keys */
+const int NDJSON_PROFILE_KEYS = 2 * MAX_ACCOUNTS + static_cast<int>(GeneralKey::COUNT);
+
+/* Sets the profile field named key from the number text; returns the slot
+ * of the key among the profile keys */
+static int setProfileField(UserData& user, const std::string& key, std::string_view number) {
+	int slot = -1;
+	std::errc ec = std::errc();
+
+	GeneralKey generalKey = lookupGeneralKey(key);
+	if (generalKey != GeneralKey::COUNT) {
+		slot = 2 * MAX_ACCOUNTS + static_cast<int>(generalKey);
+		ec = parseGeneralValue(user, generalKey, number);
+	}
+	else {
+		for (int c = 0; c < MAX_ACCOUNTS; c++) {
+			if (key == BOOK_ACCOUNT_NAMES[c]) {
+				slot = c;
+				ec = parseNumber(number, user.value[c]);
+			}
+			else if (key == BOOK_ACCOUNT_NAMES[c] + BOOK_RATE_SUFFIX) {
+				slot = MAX_ACCOUNTS + c;
+				ec = parseNumber(number, user.rate[c]);
+			}
+		}
+		if (slot < 0) {
+			throw std::runtime_error("Unknown key: " + key);
+		}
+	}
+
+	if (ec == std::errc::result_out_of_range) {
+		throw std::runtime_error("Out-of-range number for '" + key + "': " + std::string(number));
+	}
+	else if (ec != std::errc()) {
+		throw std::runtime_error("Invalid number for '" + key + "': " + std::string(number));
+	}
+	return slot;
+}
+
+void parseProfileJson(std::string_view line, UserData& user, StreamRequest& request) {
+	std::vector<bool> seen(NDJSON_PROFILE_KEYS, false);
+
+	skipBlanks(line);
+	if (line.empty() || (line.front() != '{')) {
+		throw std::runtime_error("Expected a JSON object");
+	}
+	line.remove_prefix(1);
+	skipBlanks(line);
+
+	bool first = true;
+	while (!(first && !line.empty() && (line.front() == '}'))) {
+		if (line.empty() || (line.front() != '"')) {
+			throw std::runtime_error("Expected a key");
+		}
+		std::string key = readString(line);
+		skipBlanks(line);
+		if (line.empty() || (line.front() != ':')) {
+			throw std::runtime_error("Expected ':' after '" + key + "'");
+		}
+		line.remove_prefix(1);
+		skipBlanks(line);
+
+		if (key == NDJSON_ID_KEY) {
+			if (line.empty() || (line.front() != '"')) {
+				throw std::runtime_error("Expected a string for '" + key + "'");
+			}
+			user.profileId = readString(line);
+		}
+		else {
+			size_t end = line.find_first_of(",} \t\r\n");
+			std::string_view number = line.substr(0, end);
+			line.remove_prefix(number.size());
+
+			if (key == NDJSON_SEQ_KEY) {
+				if (parseNumber(number, request.seq) != std::errc()) {
+					throw std::runtime_error("Invalid number for '" + key + "': " + std::string(number));
+				}
+				request.hasSeq = true;
+			}
+			else if (key == NDJSON_DEADLINE_KEY) {
+				if (parseNumber(number, request.deadlineMs) != std::errc()) {
+					throw std::runtime_error("Invalid number for '" + key + "': " + std::string(number));
+				}
+			}
+			else {
+				int slot = setProfileField(user, key, number);
+				if (seen[slot]) {
+					throw std::runtime_error("Duplicate key: " + key);
+				}
+				seen[slot] = true;
+			}
+		}
+
+		skipBlanks(line);
+		if (!line.empty() && (line.front() == ',')) {
+			line.remove_prefix(1);
+			skipBlanks(line);
+			first = false;
+			continue;
+		}
+		if (line.empty() || (line.front() != '}')) {
+			throw std::runtime_error("Expected ',' or '}' after '" + key + "'");
+		}
+		break;
+	}
+
+	line.remove_prefix(1);
+	skipBlanks(line);
+	if (!line.empty()) {
+		throw std::runtime_error("Unexpected text after the JSON object");
+	}
+
+	/* Optional [General] keys come last */
+	const int required = 2 * MAX_ACCOUNTS + static_cast<int>(FIRST_OPTIONAL_GENERAL_KEY);
+	for (int slot = 0; slot < required; slot++) {
+		if (!seen[slot]) {
+			throw std::runtime_error("Missing profile keys; see householdBook.h for the list of keys");
+		}
+	}
+	for (int c = 0; c < MAX_ACCOUNTS; c++) {
+		user.name[c] = BOOK_ACCOUNT_NAMES[c];
+	}
+}
+
+std::string formatResultJson(uint64_t seq, const SimResult& result) {
+	std::string out;
+	out.reserve(64 + 6 * result.longevityCounts.size());
+
+	out += "{\"seq\":";
+	appendNumber(out, seq);
+	out += ",\"id\":";
+	appendString(out, result.profileId);
+	out += ",\"seed\":";
+	appendNumber(out, result.seed);
+	out += ",\"iterations\":";
+	appendNumber(out, result.iterations);
+	out += ",\"longevity\":[";
+	for (size_t n = 0; n < result.longevityCounts.size(); n++) {
+		if (n > 0) {
+			out += ',';
+		}
+		appendNumber(out, result.longevityCounts[n]);
+	}
+	LongevityEstimate estimate = estimateLongevity(result);
+	out += "],\"mean\":";
+	appendNumber(out, estimate.mean);
+	out += ",\"ci95\":";
+	appendNumber(out, estimate.halfWidth95);
+	out += ",\"predefined\":";
+	appendNumber(out, result.predefinedLongevity);
+	out += ",\"constant\":";
+	appendNumber(out, result.constantLongevity);
+	out += '}';
+	return out;
+}
+
+/* Formats an error line */
+static std::string formatErrorJson(uint64_t seq, const std::string& id, const std::string& error) {
+	std::string out = "{\"seq\":";
+	appendNumber(out, seq);
+	out += ",\"id\":";
+	appendString(out, id);
+	out += ",\"error\":";
+	appendString(out, error);
+	out += '}';
+	return out;
+}
+
+/* Parses, validates and simulates one line into its result line; returns
+ * false if the result is an error */
+static bool processLine(const std::string& line, uint64_t index, SimClock::time_point arrival,
+                        const ScenarioBank& bank, const StreamOptions& options,
+                        std::string& output) {
+	UserData user{};
+	StreamRequest request;
+	request.seq = index;
+	try {
+		parseProfileJson(line, user, request);
+		if (!userDataWithinBounds(user, false)) {
+			output = formatErrorJson(request.seq, user.profileId, "Profile has out-of-bounds values");
+			return false;
+		}
+
+		unsigned int deadlineMs = (request.deadlineMs > 0) ? request.deadlineMs : options.deadlineMs;
+		SimClock::time_point deadline = (deadlineMs > 0) ?
+		                                arrival + std::chrono::milliseconds(deadlineMs) : NO_DEADLINE;
+		output = formatResultJson(request.seq, simulateProfileCached(user, bank, options.cache, deadline));
+		return true;
+	} catch (const std::exception& e) {
+		output = formatErrorJson(request.seq, user.profileId, e.what());
+		return false;
+	}
+}
+
+/* A line in flight */
+struct StreamSlot {
+	std::string line;
+	SimClock::time_point arrival;
+	std::string output;
+	bool ok = false;
+	bool ready = false;
+};
+
+StreamStats runNdjsonStream(std::istream& in, std::ostream& out, const ScenarioBank& bank,
+                            ThreadPool& pool, const StreamOptions& options) {
+	size_t maxInFlight = options.maxInFlight;
+	if (maxInFlight == 0) {
+		maxInFlight = NDJSON_IN_FLIGHT_PER_WORKER * pool.size();
+	}
+
+	std::vector<StreamSlot> slots(maxInFlight);
+	std::mutex mutex;
+	std::condition_variable slotReady;
+	std::condition_variable slotFree;
+
+	/* Lines read, lines written, and whether the input is exhausted */
+	uint64_t read = 0;
+	uint64_t written = 0;
+	bool eof = false;
+	StreamStats stats;
+
+	/* Writer: emits the slots in input order */
+	std::thread writer([&] {
+		std::unique_lock<std::mutex> lock(mutex);
+		while (true) {
+			StreamSlot& slot = slots[written % maxInFlight];
+			if (!slot.ready) {
+				/* Nothing to write right now; push out what was written */
+				lock.unlock();
+				out.flush();
+				lock.lock();
+				slotReady.wait(lock, [&] { return slot.ready || (eof && (written == read)); });
+				if (!slot.ready) {
+					break;
+				}
+			}
+
+			std::string output = std::move(slot.output);
+			stats.errors += slot.ok ? 0 : 1;
+			slot.ready = false;
+			written++;
+			slotFree.notify_one();
+
+			lock.unlock();
+			out << output << '\n';
+			lock.lock();
+		}
+	});
+
+	std::string line;
+	while (std::getline(in, line)) {
+		if (trim(line).empty()) {
+			continue;
+		}
+
+		/* Backpressure: wait for a free slot before taking more input */
+		std::unique_lock<std::mutex> lock(mutex);
+		slotFree.wait(lock, [&] { return read - written < maxInFlight; });
+		uint64_t index = read++;
+		StreamSlot& slot = slots[index % maxInFlight];
+		slot.line.swap(line);
+		slot.arrival = SimClock::now();
+		lock.unlock();
+
+		pool.submit([&slot, &mutex, &slotReady, &bank, &options, index] {
+			std::string output;
+			bool ok = processLine(slot.line, index, slot.arrival, bank, options, output);
+
+			std::unique_lock<std::mutex> lock(mutex);
+			slot.output = std::move(output);
+			slot.ok = ok;
+			slot.ready = true;
+			slotReady.notify_one();
+		});
+	}
+
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		eof = true;
+		stats.lines = read;
+	}
+	slotReady.notify_one();
+	writer.join();
+	out.flush();
+
+	return stats;
+}
@@ -5,12 +5,14 @@
  *
  * This file defines the main simulation control functions, including:
  *   - Running simulations for different financial models
+ *   - Running many profiles concurrently against a shared scenario bank
  *   - Aggregating and displaying fund longevity statistics
  *
  * Simulation modes include:
  *   - Constant growth
  *   - Predefined year-0 loss
  *   - Randomized recession modeling
+ *   - Correlated per-account returns
  *
  *  Created: 	June 2025
  *  Author:     Yuping X
@@ -20,113 +22,431 @@
 #include <unordered_map>
 #include <string.h>
 #include <array>
+#include <cmath>
+#include <algorithm>
+#include <stdexcept>
+#include "../include/personalFinSim.h"
 #include "../include/asset.h"
 #include "../include/constants.h"
 #include "../include/modelRecession.h"
 #include "../include/userDataLoading.h"
+#include "../include/profileSchedule.h"
+#include "../include/scenarioBank.h"
+#include "../include/taxModel.h"
+#include "../include/monthlyEngine.h"
+#include "../include/modelMortality.h"
 
 const std::unordered_map<ModelOption, std::string> modelOptionMap {
     {ModelOption::CONSTANT,                 "Constant growth model"},
     {ModelOption::PREDEFINED_YEAR0_LOSS,    "Predefined year-0 loss model"},
-    {ModelOption::RECESSION_RANDOMIZED,     "Randomized model"}
+    {ModelOption::RECESSION_RANDOMIZED,     "Randomized recession"},
+    {ModelOption::HISTORICAL_BOOTSTRAP,     "Historical block-bootstrap"},
+    {ModelOption::REGIME_SWITCHING,         "Markov regime-switching"},
+    {ModelOption::CORRELATED_ACCOUNTS,      "Correlated per-account"}
 };
 
 /**
  * @brief Helper function to group iterated simulation results into bins.
  *  .
  *
- * @param results Array of longevity data from all iterations in a simulation.
+ * @param result Longevity data from all iterations in a simulation.
  */
-static void groupResultsAndDisplay(const std::array<int, ITERATIONS>& results) {
-    const unsigned int BINS_COUNT = MAX_YEARS / RESULT_BINS_WIDTH + 1;
-
+static void groupResultsAndDisplay(const SimResult& result) {
     /* Binned results count */
-    std::array<unsigned int, BINS_COUNT> resultsBins = {0};  
+    std::array<unsigned int, RESULT_BINS_COUNT> resultsBins = {0};  
 
     int bin_index = 0;
-    for (int iter = 0; iter < ITERATIONS; iter++) {
-        bin_index = results[iter] / RESULT_BINS_WIDTH;
-        resultsBins[bin_index]++;
+    for (int years = 0; years <= MAX_YEARS; years++) {
+        bin_index = years / RESULT_BINS_WIDTH;
+        resultsBins[bin_index] += result.longevityCounts[years];
     }
 
     float resultsBinsPct;
     /* Output results summary */
     std::cout << "----------------------------------------------" << std::endl;
-    std::cout << "Randomized recession simulation summary" << std::endl;
+    std::cout << modelOptionMap.at(result.model);
+    if (result.inflation == InflationOption::STOCHASTIC) {
+        std::cout << " (stochastic inflation)";
+    }
+    if (result.tax == TaxOption::FEDERAL) {
+        std::cout << " (federal tax)";
+    }
+    if (result.step == StepOption::MONTHLY) {
+        std::cout << " (monthly steps)";
+    }
+    if (result.mortality == MortalityOption::LIFE_TABLE) {
+        std::cout << " (mortality)";
+    }
+    std::cout << " simulation summary" << std::endl;
     std::cout << "----------------------------------------------" << std::endl;
-    std::cout << "Fund longevity statistics across " << ITERATIONS << " simulations:" << std::endl;
+    if (result.iterations == 0) {
+        /* Reached after the deadline: only the deterministic models ran */
+        std::cout << "Deadline reached before any randomized simulation ran." << std::endl;
+        return;
+    }
+    std::cout << "Fund longevity statistics across " << result.iterations << " simulations:" << std::endl;
 
-    for (int b = 0; b < BINS_COUNT - 1; b++) {
-        resultsBinsPct = float(resultsBins[b]) / ITERATIONS * 100;
+    for (int b = 0; b < RESULT_BINS_COUNT - 1; b++) {
+        resultsBinsPct = float(resultsBins[b]) / result.iterations * 100;
         std::cout << RESULT_BINS_WIDTH*b << " - " << RESULT_BINS_WIDTH*(b+1)-1 \
                   << " years: " << resultsBins[b] << " runs (" << resultsBinsPct << "%)" \
                   << std::endl;
     }
 
     /* Last bin printed separately */
-    resultsBinsPct = float(resultsBins[BINS_COUNT-1]) / ITERATIONS * 100;
-    std::cout << ">= " << (BINS_COUNT-1) * RESULT_BINS_WIDTH \
-              << " years: " << resultsBins[BINS_COUNT-1] << " runs (" << resultsBinsPct << "%)" \
+    resultsBinsPct = float(resultsBins[RESULT_BINS_COUNT-1]) / result.iterations * 100;
+    std::cout << ">= " << (RESULT_BINS_COUNT-1) * RESULT_BINS_WIDTH \
+              << " years: " << resultsBins[RESULT_BINS_COUNT-1] << " runs (" << resultsBinsPct << "%)" \
               << std::endl;
+    if (result.mortality == MortalityOption::LIFE_TABLE) {
+        /* Every run short of the lifetime is one outliving its money */
+        float outlivedPct = float(result.iterations - result.longevityCounts[MAX_YEARS]) / \
+                            result.iterations * 100;
+        std::cout << "Funds ran out within the lifetime in " << outlivedPct << "% of runs" \
+                  << std::endl;
+    }
+    std::cout << "(Random seed " << result.seed << "; rerun with --seed to reproduce.)" << std::endl;
+
+    if (result.deadlineReached) {
+        /* Deadline reached: also show how precise the partial run is */
+        LongevityEstimate estimate = estimateLongevity(result);
+        std::cout << "Deadline reached; mean fund longevity = " << estimate.mean \
+                  << " years (95% CI +/- " << estimate.halfWidth95 << ")." << std::endl;
+    }
 }
 
 /**
- * @brief Runs a simulation of fund longevity based on the given model option.
+ * @brief Helper function to display a deterministic model's result.
  *
- * Initializes an Asset object using the provided user data and executes
- * the simulation using the specified growth model strategy. If the model
- * is randomized, the function runs multiple iterations and summarizes results
- * into bins. Otherwise, it runs a single deterministic simulation.
+ * @param option The simulation model.
+ * @param longevity Fund longevity under the model.
+ */
+static void displaySingleResult(ModelOption option, int longevity) {
+    std::cout << "----------------------------------------------" << std::endl;
+    std::cout << modelOptionMap.find(option)->second << " simulation summary:" << std::endl;
+    std::cout << "Fund longevity = " << longevity << " years." << std::endl;
+    std::cout << "----------------------------------------------" << std::endl;
+}
+
+/* =========================================================================
+ * Growth-Model Policies of the Randomized Runs
  *
- * @param user The user data struct for financial information and parameters.
- * @param option The simulation model to use.
+ * Each policy turns the scenarios [begin, end) of a bank into the growth
+ * curves of a profile's accounts one path at a time, calling path(iter)
+ * once the curves of scenario iter are in place. runSim() is instantiated
+ * once per policy, so the model is dispatched once per run rather than
+ * per path.
+ * ========================================================================= */
+
+/**
+ * @brief Recession, historical and regime models: one market curve per
+ *        path, scaled to each account by its stock ratio in a single pass.
  */
-static void runSim(const UserData& user, ModelOption option) {
-    Asset myAsset;
+struct MarketCurveModel {
+    template <class Path>
+    static void forEachPath(Asset& myAsset, const ScenarioBank& bank, size_t begin, size_t end,
+                            Path&& path) {
+        const std::array<float, MAX_ACCOUNTS> ratio = myAsset.stockRatios();
+        for (size_t iter = begin; iter < end; iter++) {
+            myAsset.populateGrowthCurves(bank[iter], ratio);
+            path(iter);
+        }
+    }
+};
 
-    /* Simulation iterations for investment modeling */
-    int num_iterations = 1;
-    
-    /* Result bins for categorizing fund longevity */
-    std::array<int, ITERATIONS> results;
+/**
+ * @brief Correlated per-account model: the bank's draws are turned into
+ *        this profile's returns a batch of paths at a time.
+ */
+struct CorrelatedModel {
+    template <class Path>
+    static void forEachPath(Asset& myAsset, const ScenarioBank& bank, size_t begin, size_t end,
+                            Path&& path) {
+        std::array<AccountCurves, CORRELATED_BATCH_PATHS> growth;
+        for (size_t first = begin; first < end; first += CORRELATED_BATCH_PATHS) {
+            size_t count = std::min<size_t>(CORRELATED_BATCH_PATHS, end - first);
+            correlateReturns(myAsset.returnFactor_, bank.draws(first), count, growth.data());
+            for (size_t k = 0; k < count; k++) {
+                myAsset.populateGrowthCurves(growth[k]);
+                path(first + k);
+            }
+        }
+    }
+};
 
-    if (option == ModelOption::RECESSION_RANDOMIZED) {
-        num_iterations = ITERATIONS;
+/**
+ * @brief Runs the randomized model of a profile on the scenarios [begin,
+ *        end) of a bank and counts the results by longevity.
+ *
+ * With the mortality model, each iteration only runs up to the death year
+ * of its path, and iterations whose funds last until then are counted at
+ * MAX_YEARS.
+ *
+ * @tparam Model Growth-model policy of the bank's model.
+ * @param user User profile, for its life table (used by the mortality model).
+ * @param myAsset Asset initialized from the user profile.
+ * @param schedule Precomputed cash flows of the user profile.
+ * @param bank Randomized growth curves.
+ * @param begin First scenario to run.
+ * @param end One past the last scenario to run.
+ * @param result Results to update.
+ */
+template <class Model>
+static void runSim(const UserData& user, Asset& myAsset, const ProfileSchedule& schedule,
+                   const ScenarioBank& bank, size_t begin, size_t end, SimResult& result) {
+    /* With stochastic inflation, a copy of the schedule is re-inflated
+     * with the inflation of each path */
+    bool stochasticInflation = (bank.inflation() == InflationOption::STOCHASTIC);
+    ProfileSchedule pathSchedule;
+    if (stochasticInflation) {
+        pathSchedule = schedule;
     }
+    const ProfileSchedule& used = stochasticInflation ? pathSchedule : schedule;
+    const TaxTable* tax = (bank.tax() == TaxOption::FEDERAL) ? &TaxTable::shared() : nullptr;
 
-    /* Simulation iterations for investment modeling */
-    for (int iter = 0; iter < num_iterations; iter++) {
+    /* With monthly steps, the cash flows are spread over the months once,
+     * and again for each path with stochastic inflation */
+    bool monthly = (bank.step() == StepOption::MONTHLY);
+    MonthlySchedule monthlySchedule;
+    if (monthly) {
+        monthlySchedule.initializeFromSchedule(used);
+    }
 
-        /* Initialize with user profile and populate financial planning variables over max years */
-        myAsset.initializeFromUserData(user);
+    /* With the mortality model, each path ends with the death year it
+     * draws for the profile's owner; without a birth year, the profile
+     * runs the full horizon */
+    const uint8_t* lifeQuantiles = nullptr;
+    if (bank.mortality() == MortalityOption::LIFE_TABLE) {
+        lifeQuantiles = profileLifeQuantiles(user, LifeTable::shared());
+    }
+
+    Model::forEachPath(myAsset, bank, begin, end, [&](size_t iter) {
+        if (stochasticInflation) {
+            pathSchedule.inflate(bank.inflationPath(iter));
+        }
+        int horizon = MAX_YEARS;
+        if (lifeQuantiles != nullptr) {
+            int deathYear = static_cast<int>(LifeTable::deathYear(lifeQuantiles, bank.deathDraw(iter)));
+            horizon = std::min(deathYear + 1, horizon);
+        }
 
-        /* Simulate growth curve and investment modeling */
-        myAsset.populateGrowthCurves(option);
-        myAsset.calculateN();
+        /* Simulate the path */
+        if (!monthly) {
+            myAsset.calculateN(used, tax, horizon);
+        }
+        else {
+            if (stochasticInflation) {
+                monthlySchedule.initializeFromSchedule(used);
+            }
+            myAsset.calculateMonthlyN(monthlySchedule, &bank.monthlyBridge(iter), tax, horizon);
+        }
 
-        /* Determine how long the funds lasted in this iteration */
-        results[iter] = myAsset.getFundLongevity();
+        /* Count how long the funds lasted in this iteration */
+        int longevity = myAsset.getFundLongevity();
+        result.longevityCounts[(longevity >= horizon) ? MAX_YEARS : longevity]++;
+    });
+    result.iterations += static_cast<unsigned int>(end - begin);
+}
+
+/**
+ * @brief Runs the randomized model of a bank, instantiating runSim() for
+ *        its growth model. See runSim().
+ */
+static void runRandomized(const UserData& user, Asset& myAsset, const ProfileSchedule& schedule,
+                          const ScenarioBank& bank, size_t begin, size_t end, SimResult& result) {
+    if (bank.model() == ModelOption::CORRELATED_ACCOUNTS) {
+        runSim<CorrelatedModel>(user, myAsset, schedule, bank, begin, end, result);
+    }
+    else {
+        runSim<MarketCurveModel>(user, myAsset, schedule, bank, begin, end, result);
     }
+}
 
-    if (option == ModelOption::RECESSION_RANDOMIZED) {
-        /* Binned results summary */
-        groupResultsAndDisplay(results);
+/**
+ * @brief Runs a deterministic model over the full horizon, with the tax
+ *        model and time step of a bank.
+ *
+ * @param myAsset Asset initialized from the user profile.
+ * @param schedule Precomputed cash flows of the user profile.
+ * @param option The deterministic model to use.
+ * @param bank Bank giving the tax model and time step.
+ * @param result Results to update.
+ */
+static void runDeterministic(Asset& myAsset, const ProfileSchedule& schedule, ModelOption option,
+                             const ScenarioBank& bank, SimResult& result) {
+    const TaxTable* tax = (bank.tax() == TaxOption::FEDERAL) ? &TaxTable::shared() : nullptr;
+
+    myAsset.populateGrowthCurves(option);
+    if (bank.step() == StepOption::MONTHLY) {
+        MonthlySchedule monthlySchedule;
+        monthlySchedule.initializeFromSchedule(schedule);
+        myAsset.calculateMonthlyN(monthlySchedule, nullptr, tax);
     }
     else {
-        /* Simple results summary */
-        std::cout << "----------------------------------------------" << std::endl;
-        std::cout << modelOptionMap.find(option)->second << " simulation summary:" << std::endl;
-        std::cout << "Fund longevity = " << myAsset.getFundLongevity()  << " years." << std::endl;
-        std::cout << "----------------------------------------------" << std::endl;
+        myAsset.calculateN(schedule, tax);
     }
+
+    if (option == ModelOption::PREDEFINED_YEAR0_LOSS) {
+        result.predefinedLongevity = myAsset.getFundLongevity();
+    }
+    else {
+        result.constantLongevity = myAsset.getFundLongevity();
+    }
+}
+
+/**
+ * @brief Rejects a profile with settings that the time step of a bank does
+ *        not model: the cash reserve and the spending rules are only
+ *        modeled with annual steps.
+ */
+static void checkStepSupport(const UserData& user, const ScenarioBank& bank) {
+    if ((bank.step() == StepOption::MONTHLY) && \
+        ((user.spendingRule != static_cast<unsigned short>(SpendingRule::FIXED)) || \
+         (user.cashReserveYears > 0))) {
+        throw std::runtime_error("Profile " + user.profileId + ": Spending-rule and " \
+                                 "Cash-reserve-years are not modeled with monthly steps");
+    }
+}
+
+SimResult simulateProfile(const UserData& user, const ScenarioBank& bank,
+                          SimClock::time_point deadline) {
+    checkStepSupport(user, bank);
+
+    Asset myAsset;
+    ProfileSchedule schedule;
+    SimResult result;
+
+    result.profileId = user.profileId;
+    result.seed = bank.seed();
+    result.model = bank.model();
+    result.inflation = bank.inflation();
+    result.tax = bank.tax();
+    result.step = bank.step();
+    result.mortality = bank.mortality();
+    result.iterations = 0;
+    result.deadlineReached = false;
+    result.longevityCounts.fill(0);
+    result.predefinedLongevity = 0;
+    result.constantLongevity = 0;
+
+    /* Initialize with user profile and precompute the financial planning
+     * variables over max years, which are the same in every iteration */
+    myAsset.initializeFromUserData(user);
+    schedule.initializeFromUserData(user);
+
+    /* The deterministic models are cheap and always run */
+    runDeterministic(myAsset, schedule, ModelOption::PREDEFINED_YEAR0_LOSS, bank, result);
+    runDeterministic(myAsset, schedule, ModelOption::CONSTANT, bank, result);
+
+    if (deadline == NO_DEADLINE) {
+        runRandomized(user, myAsset, schedule, bank, 0, bank.size(), result);
+        return result;
+    }
+
+    /* Run the randomized model in growing chunks until the deadline, never
+     * starting a chunk the measured speed says will not fit. A profile
+     * reached after the deadline, e.g. late in a batch, keeps only its
+     * deterministic results */
+    SimClock::time_point start = SimClock::now();
+    size_t chunk = ANYTIME_FIRST_CHUNK;
+    size_t done = 0;
+    while ((done < bank.size()) && (start < deadline)) {
+        size_t end = std::min(bank.size(), done + chunk);
+        runRandomized(user, myAsset, schedule, bank, done, end, result);
+        done = end;
+
+        SimClock::time_point now = SimClock::now();
+        if (now >= deadline) {
+            break;
+        }
+        double perIteration = std::chrono::duration<double>(now - start).count() / done;
+        double fitting = std::chrono::duration<double>(deadline - now).count() / perIteration;
+        chunk = std::min({2 * chunk, static_cast<size_t>(ANYTIME_MAX_CHUNK),
+                          static_cast<size_t>(std::min(fitting, 1e9))});
+        if (chunk == 0) {
+            break;
+        }
+    }
+
+    result.deadlineReached = (done < bank.size());
+    return result;
+}
+
+void simulateScenarios(const UserData& user, const ScenarioBank& bank, size_t begin, size_t end,
+                       SimResult& result) {
+    checkStepSupport(user, bank);
+
+    Asset myAsset;
+    ProfileSchedule schedule;
+
+    myAsset.initializeFromUserData(user);
+    schedule.initializeFromUserData(user);
+    runRandomized(user, myAsset, schedule, bank, begin, end, result);
+}
+
+void mergeSimResult(SimResult& total, const SimResult& part) {
+    for (size_t years = 0; years < total.longevityCounts.size(); years++) {
+        total.longevityCounts[years] += part.longevityCounts[years];
+    }
+    total.iterations += part.iterations;
+    total.deadlineReached = total.deadlineReached || part.deadlineReached;
+}
+
+LongevityEstimate estimateLongevity(const SimResult& result) {
+    LongevityEstimate estimate = {0.0, 0.0};
+    if (result.iterations == 0) {
+        return estimate;
+    }
+
+    double sum = 0.0;
+    double sumSquares = 0.0;
+    for (size_t years = 0; years < result.longevityCounts.size(); years++) {
+        sum += double(years) * result.longevityCounts[years];
+        sumSquares += double(years) * years * result.longevityCounts[years];
+    }
+
+    double n = result.iterations;
+    estimate.mean = sum / n;
+    if (result.iterations > 1) {
+        double variance = std::max(0.0, (sumSquares - n * estimate.mean * estimate.mean) / (n - 1));
+        estimate.halfWidth95 = 1.96 * std::sqrt(variance / n);
+    }
+    return estimate;
+}
+
+std::vector<SimResult> simulateProfiles(const std::vector<UserData>& profiles,
+                                        const ScenarioBank& bank, ThreadPool& pool,
+                                        SimClock::time_point deadline) {
+    std::vector<SimResult> results(profiles.size());
+    pool.parallelFor(profiles.size(), [&](size_t i) {
+        results[i] = simulateProfile(profiles[i], bank, deadline);
+    });
+    return results;
+}
+
+void displaySimResult(const SimResult& result) {
+    /* Binned results summary */
+    groupResultsAndDisplay(result);
+
+    /* Simple results summary */
+    displaySingleResult(ModelOption::PREDEFINED_YEAR0_LOSS, result.predefinedLongevity);
+    displaySingleResult(ModelOption::CONSTANT, result.constantLongevity);
 }
+
+void displaySimResults(const std::vector<SimResult>& results) {
+    for (const SimResult& result : results) {
+        std::cout << "\n==================== Profile " << result.profileId \
+                  << " ====================" << std::endl;
+        displaySimResult(result);
+    }
+}
+
 /**
  * @brief Runs all simulation models on the given user profile.
  *
  * @param user User financial profile used to run the simulations.
  */
 void runSimAll(const UserData& user) {
-    runSim(user, ModelOption::RECESSION_RANDOMIZED);
-    runSim(user, ModelOption::PREDEFINED_YEAR0_LOSS);
-    runSim(user, ModelOption::CONSTANT);
-}
\ No newline at end of file
+    ScenarioBank bank(clockSeed(), ITERATIONS);
+    displaySimResult(simulateProfile(user, bank));
+}
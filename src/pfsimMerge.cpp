@@ -0,0 +1,81 @@
+/* ============================================================================
+ * pfsimMerge.cpp
+ *
+ * Entry point of pfsim-merge, which combines the shards of a study run
+ * with `pfsim --shard i/n` into the results of a single-process run.
+ *
+ * Usage:
+ *   pfsim-merge [--output <merged.pfss>] <shard.pfss> [<shard.pfss> ...]
+ *
+ * The shards may be given in any order; they must all be finished and
+ * together cover every iteration of the study exactly once. The results
+ * are printed as by pfsim, and optionally saved as one study state file.
+ *
+ * Dependencies:
+ *   - studyRun.h        (Study state files and their merging)
+ *   - personalFinSim.h  (Results display)
+ *
+ *  Created:    October 2026
+ *  Author:     Yuping X
+ * ============================================================================
+ */
+#include <iostream>
+#include <string>
+#include <vector>
+#include <stdexcept>
+#include "../include/studyRun.h"
+#include "../include/personalFinSim.h"
+
+static void displayUsage() {
+    std::cout << "Usage: ./build/pfsim-merge [--output <merged.pfss>] <shard.pfss> [<shard.pfss> ...]" \
+              << std::endl;
+}
+
+int main(int argc, char **argv) {
+    std::string outputFile;
+    std::vector<std::string> shardFiles;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if ((arg == "--output") && (i+1 < argc)) {
+            outputFile = argv[++i];
+        }
+        else if (arg == "--help") {
+            displayUsage();
+            return 0;
+        }
+        else if (arg.rfind("--", 0) == 0) {
+            std::cerr << "Unknown option: " << arg << std::endl;
+            return 1;
+        }
+        else {
+            shardFiles.push_back(arg);
+        }
+    }
+
+    if (shardFiles.empty()) {
+        displayUsage();
+        return 1;
+    }
+
+    try {
+        std::vector<StudyState> shards;
+        for (const std::string& shardFile : shardFiles) {
+            shards.push_back(readStudyState(shardFile));
+        }
+        StudyState merged = mergeStudyStates(shards);
+
+        if (!outputFile.empty()) {
+            writeStudyState(outputFile, merged);
+        }
+
+        std::cout << "Loaded " << merged.results.size() << " profile(s)." << std::endl;
+        displaySimResults(merged.results);
+    }
+    catch (const std::runtime_error& e) {
+        std::cerr << "ERROR: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,174 @@
+/* ============================================================================
+ * profileBinary.cpp
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Implements writing and memory-mapped loading of compiled binary profiles.
+ *
+ *  Dependencies:
+ *    - profileBinary.h
+ *    - mappedFile.h
+ *    - userDataLoading.h
+ *
+ *  Created:    October 2026
+ *  Author:     Yuping X
+ * ============================================================================
+ */
+
+#include <fstream>
+#include <cstring>
+#include <stdexcept>
+#include "../include/profileBinary.h"
+#include "../include/mappedFile.h"
+#include "../include/userDataLoading.h"
+
+/* Copies a name into a fixed-length, zero-padded field */
+static void copyName(char* field, const std::string& name) {
+    if (name.size() >= PROFILE_BINARY_NAME_SIZE) {
+        throw std::runtime_error("Name '" + name + "' is longer than " + \
+                                 std::to_string(PROFILE_BINARY_NAME_SIZE - 1) + " characters");
+    }
+    std::memcpy(field, name.data(), name.size());
+}
+
+/* Reads a fixed-length, zero-padded name field */
+static std::string readName(const char* field) {
+    return std::string(field, strnlen(field, PROFILE_BINARY_NAME_SIZE));
+}
+
+uint64_t profileChecksum(const void* data, size_t size) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    uint64_t h = 14695981039346656037ull;
+    for (size_t i = 0; i < size; i++) {
+        h = (h ^ bytes[i]) * 1099511628211ull;
+    }
+    return h;
+}
+
+void recordFromUserData(const UserData& user, ProfileRecord& record) {
+    /* Zero everything, including padding, so that files are reproducible */
+    std::memset(&record, 0, sizeof(record));
+
+    copyName(record.profileId, user.profileId);
+    for (int c = 0; c < MAX_ACCOUNTS; c++) {
+        copyName(record.name[c], user.name[c]);
+        record.value[c] = user.value[c];
+        record.rate[c] = user.rate[c];
+    }
+    record.initialExpense = user.initialExpense;
+    record.takehomeIncome = user.takehomeIncome;
+    record.contributionRoth = user.contributionRoth;
+    record.contributionIra = user.contributionIra;
+    record.contributionR401k = user.contributionR401k;
+    record.pensionEstimate = user.pensionEstimate;
+    record.initialInflation = user.initialInflation;
+    record.yearsTillRetirement = user.yearsTillRetirement;
+    record.yearsTillWithdrawal = user.yearsTillWithdrawal;
+    record.yearsTillPension = user.yearsTillPension;
+    record.birthYear = user.birthYear;
+    record.cashReserveYears = user.cashReserveYears;
+    record.cashReserveRefill = user.cashReserveRefill;
+    record.sex = user.sex;
+    record.spendingRule = user.spendingRule;
+    std::memcpy(record.covariance, user.covariance, sizeof(record.covariance));
+    std::memcpy(record.eventExpense, user.eventExpense, sizeof(record.eventExpense));
+}
+
+void userDataFromRecord(const ProfileRecord& record, UserData& user) {
+    user.profileId = readName(record.profileId);
+    for (int c = 0; c < MAX_ACCOUNTS; c++) {
+        user.name[c] = readName(record.name[c]);
+        user.value[c] = record.value[c];
+        user.rate[c] = record.rate[c];
+    }
+    user.initialExpense = record.initialExpense;
+    user.takehomeIncome = record.takehomeIncome;
+    user.contributionRoth = record.contributionRoth;
+    user.contributionIra = record.contributionIra;
+    user.contributionR401k = record.contributionR401k;
+    user.pensionEstimate = record.pensionEstimate;
+    user.initialInflation = record.initialInflation;
+    user.yearsTillRetirement = record.yearsTillRetirement;
+    user.yearsTillWithdrawal = record.yearsTillWithdrawal;
+    user.yearsTillPension = record.yearsTillPension;
+    user.birthYear = record.birthYear;
+    user.cashReserveYears = record.cashReserveYears;
+    user.cashReserveRefill = record.cashReserveRefill;
+    user.sex = record.sex;
+    user.spendingRule = record.spendingRule;
+    std::memcpy(user.covariance, record.covariance, sizeof(user.covariance));
+    std::memcpy(user.eventExpense, record.eventExpense, sizeof(user.eventExpense));
+}
+
+void writeCompiledProfiles(const std::string& filename, const std::vector<UserData>& profiles) {
+    std::vector<ProfileRecord> records(profiles.size());
+    for (size_t i = 0; i < profiles.size(); i++) {
+        if (!userDataWithinBounds(profiles[i])) {
+            throw std::runtime_error("Profile " + profiles[i].profileId + \
+                                     " is out of bounds and cannot be compiled");
+        }
+        recordFromUserData(profiles[i], records[i]);
+    }
+
+    ProfileBinaryHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, PROFILE_BINARY_MAGIC, sizeof(header.magic));
+    header.version = PROFILE_BINARY_VERSION;
+    header.recordSize = sizeof(ProfileRecord);
+    header.recordCount = records.size();
+    header.checksum = profileChecksum(records.data(), records.size() * sizeof(ProfileRecord));
+
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        throw std::runtime_error("Could not open " + filename + " for writing");
+    }
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(records.data()), records.size() * sizeof(ProfileRecord));
+    if (!file) {
+        throw std::runtime_error("Could not write compiled profiles to " + filename);
+    }
+}
+
+CompiledProfiles::CompiledProfiles(const std::string& filename) : file_(filename)
+{
+    std::string_view data = file_.data();
+    records_ = nullptr;
+    count_ = 0;
+
+    if (data.size() < sizeof(ProfileBinaryHeader)) {
+        throw std::runtime_error(filename + " is too small to be a compiled profile file");
+    }
+    const ProfileBinaryHeader* header = reinterpret_cast<const ProfileBinaryHeader*>(data.data());
+
+    if (std::memcmp(header->magic, PROFILE_BINARY_MAGIC, sizeof(header->magic)) != 0) {
+        throw std::runtime_error(filename + " is not a compiled profile file");
+    }
+    if (header->version != PROFILE_BINARY_VERSION) {
+        throw std::runtime_error(filename + " has compiled format version " + \
+                                 std::to_string(header->version) + ", expected " + \
+                                 std::to_string(PROFILE_BINARY_VERSION) + "; please recompile it");
+    }
+    /* The count is untrusted: compare it by division, which cannot wrap */
+    size_t body = data.size() - sizeof(ProfileBinaryHeader);
+    if ((header->recordSize != sizeof(ProfileRecord)) || (body % sizeof(ProfileRecord) != 0) || \
+        (header->recordCount != body / sizeof(ProfileRecord))) {
+        throw std::runtime_error(filename + " has an unexpected size");
+    }
+
+    records_ = reinterpret_cast<const ProfileRecord*>(data.data() + sizeof(ProfileBinaryHeader));
+    count_ = header->recordCount;
+
+    if (profileChecksum(records_, count_ * sizeof(ProfileRecord)) != header->checksum) {
+        throw std::runtime_error(filename + " failed its checksum; the file is corrupted");
+    }
+}
+
+size_t CompiledProfiles::size() const
+{
+    return count_;
+}
+
+const ProfileRecord& CompiledProfiles::operator[](size_t index) const
+{
+    return records_[index];
+}
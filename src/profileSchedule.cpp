@@ -0,0 +1,336 @@
+/* ============================================================================
+ * profileSchedule.cpp
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Implementation of the ProfileSchedule class.
+ *
+ *  Dependencies:
+ *    - profileSchedule.h
+ *    - asset.h
+ *    - constants.h
+ *    - rmdTable.h
+ *
+ *  Created:    October 2026
+ *  Author:     Yuping X
+ * ============================================================================
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include "../include/profileSchedule.h"
+#include "../include/asset.h"
+#include "../include/constants.h"
+#include "../include/rmdTable.h"
+
+/* Bound below which inflated amounts are truncated through 32 bits, with
+ * a margin for the rounding of the float product */
+static const float INFLATE_32BIT_LIMIT = 2.0e9f;
+
+void ProfileSchedule::fillCashFlows(long int expense, long int income, long int roth,
+                                    long int ira, long int r401k, int pension,
+                                    int yearsTillRetirement, int yearsTillPension,
+                                    const std::array<float, MAX_YEARS>& inflation)
+{
+	yearsTillRetirement_ = yearsTillRetirement;
+	inflation_ = inflation;
+	accumulationFastPath_ = true;
+
+	for (int i = 0; i < MAX_YEARS; i++) {
+		/* Once retirement year is reached, deactivate recurring income and
+		 * contributions */
+		if (i == yearsTillRetirement) {
+			income = 0;
+			roth = 0;
+			ira = 0;
+			r401k = 0;
+		}
+
+		int pension_income = (i >= yearsTillPension) ? pension : 0;
+
+		expense_[i] = expense;
+		income_[i] = income;
+		pension_[i] = pension_income;
+		netExpense_[i] = std::max(expense - income - pension_income, (long int) 0);
+
+		if ((i < yearsTillRetirement) && (netExpense_[i] > 0)) {
+			accumulationFastPath_ = false;
+		}
+
+		/* Contributions are only made before retirement, and only if there is
+		 * a following year to add them to. */
+		if ((i < yearsTillRetirement) && (i + 1 < MAX_YEARS)) {
+			contribution_[INDIVIDUAL_INDEX][i] = std::max(income + pension_income - expense, (long int) 0);
+			contribution_[ROTH_INDEX][i] = roth;
+			contribution_[IRA_INDEX][i] = ira;
+			contribution_[R401K_INDEX][i] = r401k;
+
+			/* Update contributions and takehome job income by the rate of
+			 * inflation. */
+			roth = roth * (1 + inflation[i]);
+			ira = ira * (1 + inflation[i]);
+			r401k = r401k * (1 + inflation[i]);
+			income = income * (1 + inflation[i]);
+		}
+		else {
+			for (int c = 0; c < MAX_ACCOUNTS; c++) {
+				contribution_[c][i] = 0;
+			}
+		}
+
+		/* Update next year's projected expense and pension income */
+		if (i + 1 < MAX_YEARS) {
+			expense = expense * (1 + inflation[i]);
+			pension = pension * (1 + inflation[i]);
+		}
+	}
+}
+
+void ProfileSchedule::initializeFromUserData(const UserData& user)
+{
+	std::array<float, MAX_YEARS> inflation;
+	inflation.fill(user.initialInflation);
+
+	for (int c = 0; c < MAX_ACCOUNTS; c++) {
+		initialValue_[c] = user.value[c];
+	}
+
+	/* The individual account is always available; tax-advantaged accounts
+	 * become available in the withdrawal year (but never in year 0). */
+	for (int i = 0; i < MAX_YEARS; i++) {
+		availability_[INDIVIDUAL_INDEX][i] = true;
+		bool withdrawable = (i > 0) && (i >= user.yearsTillWithdrawal);
+		availability_[ROTH_INDEX][i] = withdrawable;
+		availability_[IRA_INDEX][i] = withdrawable;
+		availability_[R401K_INDEX][i] = withdrawable;
+	}
+
+	baseExpense_ = user.initialExpense;
+	baseIncome_ = user.takehomeIncome;
+	baseRoth_ = user.contributionRoth;
+	baseIra_ = user.contributionIra;
+	baseR401k_ = user.contributionR401k;
+	basePension_ = user.pensionEstimate;
+	yearsTillPension_ = user.yearsTillPension;
+	baseInflation_ = inflation;
+	for (int i = 0; i < MAX_YEARS; i++) {
+		baseEvents_[i] = static_cast<float>(user.eventExpense[i]);
+	}
+
+	fillCashFlows(baseExpense_, baseIncome_, baseRoth_, baseIra_, baseR401k_, basePension_,
+	              user.yearsTillRetirement, yearsTillPension_, baseInflation_);
+	prepareInflation();
+	applyEvents();
+	fillRequiredDistributions(user.birthYear);
+	cashReserveYears_ = user.cashReserveYears;
+	cashReserveRefill_ = user.cashReserveRefill;
+	spendingRule_ = static_cast<SpendingRule>(user.spendingRule);
+}
+
+void ProfileSchedule::initializeFromAsset(const Asset& asset)
+{
+	for (int c = 0; c < MAX_ACCOUNTS; c++) {
+		initialValue_[c] = asset.value_[c][0];
+		availability_[c] = asset.availability_[c];
+	}
+
+	baseExpense_ = asset.expense_[0];
+	baseIncome_ = asset.takehomeIncome_;
+	baseRoth_ = asset.contributionRoth_;
+	baseIra_ = asset.contributionIra_;
+	baseR401k_ = asset.contributionR401k_;
+	basePension_ = asset.pensionEstimate_;
+	yearsTillPension_ = asset.yearsTillPension_;
+	baseInflation_ = asset.inflation_;
+	baseEvents_.fill(0.0f);
+
+	fillCashFlows(baseExpense_, baseIncome_, baseRoth_, baseIra_, baseR401k_, basePension_,
+	              asset.yearsTillRetirement_, yearsTillPension_, baseInflation_);
+	prepareInflation();
+	fillRequiredDistributions(0);
+	cashReserveYears_ = 0.0f;
+	cashReserveRefill_ = 0.0f;
+	spendingRule_ = SpendingRule::FIXED;
+}
+
+void ProfileSchedule::fillRequiredDistributions(int birthYear)
+{
+	rmdRate_.fill(0.0f);
+	rmdStartYear_ = MAX_YEARS;
+	if (birthYear == 0) {
+		return;
+	}
+
+	const int startAge = rmdStartAge(birthYear);
+	for (int i = 0; i < MAX_YEARS; i++) {
+		int age = CURRENT_YEAR + i - birthYear;
+		if (age >= startAge) {
+			rmdRate_[i] = 1.0f / rmdDivisor(age);
+			rmdStartYear_ = std::min(rmdStartYear_, i);
+
+			/* Required distributions are taken whatever the withdrawal
+			 * year, and can as well be spent */
+			availability_[IRA_INDEX][i] = true;
+			availability_[R401K_INDEX][i] = true;
+		}
+	}
+}
+
+void ProfileSchedule::prepareInflation()
+{
+	float growth = 1.0f;
+	for (int i = 0; i < MAX_YEARS; i++) {
+		baseGrowth_[i] = growth;
+		growth *= 1 + baseInflation_[i];
+	}
+	priceLevel_ = baseGrowth_;
+
+	/* Net expense of each year in year-0 dollars; every amount of a year
+	 * is inflated by the same factor */
+	for (int i = 0; i < MAX_YEARS; i++) {
+		long int income = (i < yearsTillRetirement_) ? baseIncome_ : 0;
+		long int pension = (i >= yearsTillPension_) ? basePension_ : 0;
+		baseNetExpense_[i] = static_cast<float>(baseExpense_ - income - pension) + baseEvents_[i];
+	}
+
+	largestAmount_ = static_cast<float>(std::max({baseExpense_, baseIncome_, (long int) basePension_,
+	                                              baseRoth_, baseIra_, baseR401k_}));
+	for (int i = 0; i < MAX_YEARS; i++) {
+		largestAmount_ = std::max({largestAmount_, std::abs(baseNetExpense_[i]),
+		                           std::abs(baseExpense_ + baseEvents_[i])});
+	}
+}
+
+void ProfileSchedule::applyEvents()
+{
+	/* The events of a year are inflated with its expense but truncated on
+	 * their own, so that a profile without events keeps the year-by-year
+	 * amounts of fillCashFlows(). Each year is independent of the others:
+	 * no per-event or per-year branch is left. */
+	const int working = std::clamp(yearsTillRetirement_, 0, int(MAX_YEARS));
+	const int contributing = std::min(working, int(MAX_YEARS) - 1);
+	for (int i = 0; i < MAX_YEARS; i++) {
+		expense_[i] += static_cast<long int>(baseEvents_[i] * baseGrowth_[i]);
+		netExpense_[i] = std::max(expense_[i] - income_[i] - pension_[i], (long int) 0);
+	}
+	for (int i = 0; i < contributing; i++) {
+		contribution_[INDIVIDUAL_INDEX][i] = std::max(income_[i] + pension_[i] - expense_[i], (long int) 0);
+	}
+
+	long int distributed = 0;
+	for (int i = 0; i < working; i++) {
+		distributed |= netExpense_[i];
+	}
+	accumulationFastPath_ = (distributed == 0);
+}
+
+void ProfileSchedule::inflate(const InflationPath& path)
+{
+	/* Cumulative inflation of each year since year 0, from the cumulative
+	 * products of the profile and of the path. Amounts are then truncated
+	 * once instead of year by year, so that no loop carries a dependency
+	 * from one year to the next. */
+	std::array<float, MAX_YEARS> factor;
+	for (int i = 0; i < MAX_YEARS; i++) {
+		inflation_[i] = (1 + baseInflation_[i]) * (1 + path.deviation[i]) - 1;
+		factor[i] = baseGrowth_[i] * path.growth[i];
+	}
+
+	/* Amounts that fit in 32 bits are truncated through a 32-bit integer,
+	 * whose conversion from float vectorizes where the 64-bit one does not */
+	const float limit = INFLATE_32BIT_LIMIT / std::max(largestAmount_, 1.0f);
+	int exceeding = 0;
+	for (int i = 0; i < MAX_YEARS; i++) {
+		exceeding |= (factor[i] >= limit);
+	}
+	if (exceeding == 0) {
+		inflateAmounts<int32_t>(factor);
+	}
+	else {
+		inflateAmounts<long int>(factor);
+	}
+	priceLevel_ = factor;
+}
+
+template <typename Dollars>
+void ProfileSchedule::inflateAmounts(const std::array<float, MAX_YEARS>& factor)
+{
+	/* Income and contributions past retirement, and pension before it
+	 * starts, are zero whatever the inflation, and stay as built */
+	const int working = std::clamp(yearsTillRetirement_, 0, int(MAX_YEARS));
+	const int contributing = std::min(working, int(MAX_YEARS) - 1);
+	const int pensionStart = std::clamp(yearsTillPension_, 0, int(MAX_YEARS));
+
+	/* Year-0 amounts are read into locals once, as the stores below could
+	 * otherwise alias them and force a reload every year */
+	const float expense = baseExpense_;
+	const float income = baseIncome_;
+	const float pension = basePension_;
+	const float roth = baseRoth_;
+	const float ira = baseIra_;
+	const float r401k = baseR401k_;
+
+	for (int i = 0; i < MAX_YEARS; i++) {
+		expense_[i] = static_cast<Dollars>((expense + baseEvents_[i]) * factor[i]);
+	}
+	for (int i = pensionStart; i < MAX_YEARS; i++) {
+		pension_[i] = static_cast<Dollars>(pension * factor[i]);
+	}
+	for (int i = 0; i < working; i++) {
+		income_[i] = static_cast<Dollars>(income * factor[i]);
+	}
+
+	/* The net expense and the income surplus are inflated as a whole,
+	 * rather than subtracted from the truncated amounts */
+	for (int i = 0; i < MAX_YEARS; i++) {
+		netExpense_[i] = static_cast<Dollars>(std::max(baseNetExpense_[i] * factor[i], 0.0f));
+	}
+	long int distributed = 0;
+	for (int i = 0; i < working; i++) {
+		distributed |= netExpense_[i];
+	}
+	accumulationFastPath_ = (distributed == 0);
+
+	for (int i = 0; i < contributing; i++) {
+		contribution_[INDIVIDUAL_INDEX][i] = static_cast<Dollars>(std::max(-baseNetExpense_[i] * factor[i], 0.0f));
+		contribution_[ROTH_INDEX][i] = static_cast<Dollars>(roth * factor[i]);
+		contribution_[IRA_INDEX][i] = static_cast<Dollars>(ira * factor[i]);
+		contribution_[R401K_INDEX][i] = static_cast<Dollars>(r401k * factor[i]);
+	}
+}
+
+ProfileSchedule::ProfileSchedule()
+{
+	initialValue_.fill(0);
+	expense_.fill(0);
+	income_.fill(0);
+	pension_.fill(0);
+	netExpense_.fill(0);
+	inflation_.fill(0.0f);
+	priceLevel_.fill(1.0f);
+	rmdRate_.fill(0.0f);
+	rmdStartYear_ = MAX_YEARS;
+	cashReserveYears_ = 0.0f;
+	cashReserveRefill_ = 0.0f;
+	spendingRule_ = SpendingRule::FIXED;
+	yearsTillRetirement_ = 0;
+	accumulationFastPath_ = false;
+	baseExpense_ = 0;
+	baseIncome_ = 0;
+	baseRoth_ = 0;
+	baseIra_ = 0;
+	baseR401k_ = 0;
+	basePension_ = 0;
+	yearsTillPension_ = 0;
+	baseInflation_.fill(0.0f);
+	baseGrowth_.fill(1.0f);
+	baseEvents_.fill(0.0f);
+	baseNetExpense_.fill(0.0f);
+	largestAmount_ = 0.0f;
+
+	for (int c = 0; c < MAX_ACCOUNTS; c++) {
+		contribution_[c].fill(0);
+		availability_[c].fill(false);
+	}
+}
@@ -0,0 +1,215 @@
+/* ============================================================================
+ * resultCache.cpp
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Implementation of the ResultCache class.
+ *
+ *  Dependencies:
+ *    - resultCache.h
+ *    - modelRecession.h
+ *    - modelHistorical.h
+ *    - modelRegime.h
+ *    - modelCorrelated.h
+ *    - modelInflation.h
+ *    - modelMortality.h
+ *
+ *  Created:    October 2026
+ *  Author:     Yuping X
+ * ============================================================================
+ */
+
+#include <cstring>
+#include <vector>
+#include "../include/resultCache.h"
+#include "../include/modelRecession.h"
+#include "../include/modelHistorical.h"
+#include "../include/modelRegime.h"
+#include "../include/modelCorrelated.h"
+#include "../include/modelInflation.h"
+#include "../include/modelMortality.h"
+#include "../include/constants.h"
+
+/* Appends the bytes of a value to a buffer */
+template <typename T>
+static void appendBytes(std::vector<unsigned char>& buffer, const T& value) {
+	const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&value);
+	buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+
+uint64_t modelConstantsHash() {
+	static const uint64_t hash = [] {
+		std::vector<unsigned char> buffer;
+		appendBytes(buffer, SIM_MODEL_VERSION);
+		appendBytes(buffer, MAX_YEARS);
+		/* Formerly the fixed cash reserve, always 0; now a profile setting */
+		appendBytes(buffer, 0u);
+		appendBytes(buffer, STOCK_GROWTH_AVG);
+		appendBytes(buffer, STOCK_AVG_SPAN);
+		appendBytes(buffer, RECESSION_MIN);
+		appendBytes(buffer, RECESSION_MAX);
+		appendBytes(buffer, RECESSION_START_MOD);
+		appendBytes(buffer, RECESSION_INT_MIN);
+		appendBytes(buffer, RECESSION_INT_MAX);
+		appendBytes(buffer, RECOVERY_INT_MIN);
+		appendBytes(buffer, RECOVERY_INT_MAX);
+		appendBytes(buffer, RANDOM_NUM_MIN);
+		appendBytes(buffer, RANDOM_NUM_MAX);
+		appendBytes(buffer, RECESSION_YEAR0_LOSS);
+		return profileChecksum(buffer.data(), buffer.size());
+	}();
+	return hash;
+}
+
+uint64_t scenarioModelHash(ModelOption model, InflationOption inflation, TaxOption tax, StepOption step,
+                           MortalityOption mortality) {
+	std::vector<unsigned char> buffer;
+	appendBytes(buffer, modelConstantsHash());
+	appendBytes(buffer, model);
+	if (model == ModelOption::HISTORICAL_BOOTSTRAP) {
+		appendBytes(buffer, HISTORICAL_BLOCK_YEARS);
+		appendBytes(buffer, HistoricalReturns::shared().checksum());
+	}
+	else if (model == ModelOption::REGIME_SWITCHING) {
+		appendBytes(buffer, RegimeModel::shared().checksum());
+	}
+	else if (model == ModelOption::CORRELATED_ACCOUNTS) {
+		appendBytes(buffer, STOCK_VOLATILITY);
+		appendBytes(buffer, ACCOUNT_CORRELATION_DEFAULT);
+		appendBytes(buffer, NORMAL_TABLE_BITS);
+	}
+
+	/* Constant inflation leaves the hash of the growth models as it was */
+	if (inflation == InflationOption::STOCHASTIC) {
+		appendBytes(buffer, inflation);
+		appendBytes(buffer, INFLATION_PERSISTENCE);
+		appendBytes(buffer, INFLATION_VOLATILITY);
+		appendBytes(buffer, INFLATION_MARKET_CORRELATION);
+		appendBytes(buffer, STOCK_VOLATILITY);
+		appendBytes(buffer, NORMAL_TABLE_BITS);
+	}
+
+	/* Nor does untaxed simulation */
+	if (tax == TaxOption::FEDERAL) {
+		appendBytes(buffer, tax);
+		appendBytes(buffer, TaxTable::shared().checksum());
+	}
+
+	/* Nor do annual steps */
+	if (step == StepOption::MONTHLY) {
+		appendBytes(buffer, step);
+		appendBytes(buffer, MONTHLY_BRIDGE_LIMIT);
+		appendBytes(buffer, MONTHLY_MIN_LEVEL);
+	}
+
+	/* Nor does the fixed horizon */
+	if (mortality == MortalityOption::LIFE_TABLE) {
+		appendBytes(buffer, mortality);
+		appendBytes(buffer, LifeTable::shared().checksum());
+		appendBytes(buffer, MORTALITY_TABLE_BITS);
+	}
+	return profileChecksum(buffer.data(), buffer.size());
+}
+
+void canonicalRecord(const UserData& user, ProfileRecord& record) {
+	UserData canonical = user;
+	canonical.profileId.clear();
+	for (int c = 0; c < MAX_ACCOUNTS; c++) {
+		canonical.name[c].clear();
+	}
+	recordFromUserData(canonical, record);
+}
+
+CacheKey makeCacheKey(const UserData& user, const ScenarioBank& bank) {
+	CacheKey key;
+	std::memset(&key, 0, sizeof(key));
+	canonicalRecord(user, key.record);
+	key.iterations = static_cast<uint32_t>(bank.size());
+	key.seed = bank.seed();
+	key.modelHash = scenarioModelHash(bank.model(), bank.inflation(), bank.tax(), bank.step(),
+	                                   bank.mortality());
+	return key;
+}
+
+bool CacheKey::operator==(const CacheKey& other) const {
+	return std::memcmp(this, &other, sizeof(CacheKey)) == 0;
+}
+
+size_t CacheKeyHash::operator()(const CacheKey& key) const {
+	return static_cast<size_t>(profileChecksum(&key, sizeof(CacheKey)));
+}
+
+/* An entry holds the key twice (list and index), the result, and the list
+ * and hash node overheads */
+const size_t ResultCache::ENTRY_BYTES = 2 * sizeof(CacheKey) + sizeof(SimResult) + 8 * sizeof(void*);
+
+ResultCache::ResultCache(size_t maxBytes)
+	: maxBytes_(maxBytes)
+{
+}
+
+bool ResultCache::lookup(const CacheKey& key, SimResult& result) {
+	std::unique_lock<std::mutex> lock(mutex_);
+	auto it = index_.find(key);
+	if (it == index_.end()) {
+		stats_.misses++;
+		return false;
+	}
+
+	entries_.splice(entries_.begin(), entries_, it->second);
+	result = it->second->second;
+	stats_.hits++;
+	return true;
+}
+
+void ResultCache::insert(const CacheKey& key, const SimResult& result) {
+	if (ENTRY_BYTES > maxBytes_) {
+		return;
+	}
+
+	std::unique_lock<std::mutex> lock(mutex_);
+	auto it = index_.find(key);
+	if (it != index_.end()) {
+		/* Another request simulated the same profile meanwhile */
+		entries_.splice(entries_.begin(), entries_, it->second);
+		return;
+	}
+
+	while (stats_.bytes + ENTRY_BYTES > maxBytes_) {
+		index_.erase(entries_.back().first);
+		entries_.pop_back();
+		stats_.bytes -= ENTRY_BYTES;
+		stats_.entries--;
+		stats_.evictions++;
+	}
+
+	entries_.emplace_front(key, result);
+	index_.emplace(key, entries_.begin());
+	stats_.bytes += ENTRY_BYTES;
+	stats_.entries++;
+}
+
+CacheStats ResultCache::stats() const {
+	std::unique_lock<std::mutex> lock(mutex_);
+	return stats_;
+}
+
+SimResult simulateProfileCached(const UserData& user, const ScenarioBank& bank, ResultCache* cache,
+                                SimClock::time_point deadline) {
+	if (cache == nullptr) {
+		return simulateProfile(user, bank, deadline);
+	}
+
+	CacheKey key = makeCacheKey(user, bank);
+	SimResult result;
+	if (cache->lookup(key, result)) {
+		result.profileId = user.profileId;
+		return result;
+	}
+
+	result = simulateProfile(user, bank, deadline);
+	if (!result.deadlineReached) {
+		cache->insert(key, result);
+	}
+	return result;
+}
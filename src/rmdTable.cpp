@@ -0,0 +1,45 @@
+/* ============================================================================
+ * rmdTable.cpp
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Implements the required minimum distribution rules.
+ *
+ *  Dependencies:
+ *    - rmdTable.h
+ *
+ *  Created:    October 2026
+ *  Author:     Yuping X
+ * ============================================================================
+ */
+
+#include <array>
+#include <algorithm>
+#include "../include/rmdTable.h"
+
+/* IRS Uniform Lifetime Table (2022 on), by age from RMD_FIRST_AGE */
+static const std::array<float, RMD_LAST_AGE - RMD_FIRST_AGE + 1> RMD_DIVISORS = {
+	27.4f, 26.5f, 25.5f, 24.6f, 23.7f, 22.9f, 22.0f, 21.1f, /* 72 - 79 */
+	20.2f, 19.4f, 18.5f, 17.7f, 16.8f, 16.0f, 15.2f, 14.4f, /* 80 - 87 */
+	13.7f, 12.9f, 12.2f, 11.5f, 10.8f, 10.1f, 9.5f, 8.9f, /* 88 - 95 */
+	8.4f, 7.8f, 7.3f, 6.8f, 6.4f, 6.0f, 5.6f, 5.2f, /* 96 - 103 */
+	4.9f, 4.6f, 4.3f, 4.1f, 3.9f, 3.7f, 3.5f, 3.4f, /* 104 - 111 */
+	3.3f, 3.1f, 3.0f, 2.9f, 2.8f, 2.7f, 2.5f, 2.3f, /* 112 - 119 */
+	2.0f /* 120 and on */
+};
+
+int rmdStartAge(int birthYear)
+{
+	if (birthYear >= 1960) {
+		return 75;
+	}
+	if (birthYear >= 1951) {
+		return 73;
+	}
+	return RMD_FIRST_AGE;
+}
+
+float rmdDivisor(int age)
+{
+	return RMD_DIVISORS[std::clamp(age, RMD_FIRST_AGE, RMD_LAST_AGE) - RMD_FIRST_AGE];
+}
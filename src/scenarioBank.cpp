@@ -0,0 +1,204 @@
+/* ============================================================================
+ * scenarioBank.cpp
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Implementation of the ScenarioBank class.
+ *
+ *  Dependencies:
+ *    - scenarioBank.h
+ *    - scenarioRng.h
+ *    - modelRecession.h
+ *    - modelHistorical.h
+ *    - modelRegime.h
+ *    - modelCorrelated.h
+ *    - modelInflation.h
+ *    - taxModel.h
+ *    - monthlyEngine.h
+ *    - modelMortality.h
+ *
+ *  Created:    October 2026
+ *  Author:     Yuping X
+ * ============================================================================
+ */
+
+#include <chrono>
+#include "../include/scenarioBank.h"
+#include "../include/scenarioRng.h"
+#include "../include/modelRecession.h"
+#include "../include/modelHistorical.h"
+#include "../include/modelRegime.h"
+#include "../include/modelCorrelated.h"
+#include "../include/modelInflation.h"
+#include "../include/taxModel.h"
+#include "../include/monthlyEngine.h"
+#include "../include/modelMortality.h"
+
+ScenarioBank::ScenarioBank(uint64_t seed, unsigned int iterations, ThreadPool* pool, ModelOption model,
+                           InflationOption inflation, TaxOption tax, StepOption step,
+                           MortalityOption mortality)
+	: ScenarioBank(seed, 0, iterations, pool, model, inflation, tax, step, mortality)
+{
+}
+
+ScenarioBank::ScenarioBank(uint64_t seed, uint64_t first, unsigned int iterations, ThreadPool* pool,
+                           ModelOption model, InflationOption inflation, TaxOption tax, StepOption step,
+                           MortalityOption mortality)
+	: seed_(seed), first_(first), model_(model), inflation_(inflation), tax_(tax), step_(step),
+	  mortality_(mortality), size_(iterations)
+{
+	if (model_ == ModelOption::CORRELATED_ACCOUNTS) {
+		draws_.resize(iterations);
+	}
+	else {
+		curves_.resize(iterations);
+	}
+	if (inflation_ == InflationOption::STOCHASTIC) {
+		inflationPaths_.resize(iterations);
+		normalQuantiles();
+	}
+	if (step_ == StepOption::MONTHLY) {
+		bridges_.resize(iterations);
+		normalQuantiles();
+	}
+
+	/* Model data is loaded before the workers start, so that a missing
+	 * file is reported here rather than from a worker */
+	const HistoricalReturns* table = nullptr;
+	const RegimeModel* regimes = nullptr;
+	if (model_ == ModelOption::HISTORICAL_BOOTSTRAP) {
+		table = &HistoricalReturns::shared();
+	}
+	else if (model_ == ModelOption::REGIME_SWITCHING) {
+		regimes = &RegimeModel::shared();
+	}
+	else if (model_ == ModelOption::CORRELATED_ACCOUNTS) {
+		normalQuantiles();
+	}
+	if (tax_ == TaxOption::FEDERAL) {
+		TaxTable::shared();
+	}
+	if (mortality_ == MortalityOption::LIFE_TABLE) {
+		LifeTable::shared();
+		deathDraws_.resize(iterations);
+	}
+
+	auto generate = [this, table, regimes](size_t iter) {
+		ScenarioRng generator(seed_, first_ + iter);
+		switch (model_) {
+			case ModelOption::HISTORICAL_BOOTSTRAP:
+				generateHistoricalBootstrap(curves_[iter], generator, *table);
+				break;
+
+			case ModelOption::REGIME_SWITCHING:
+				generateRegimeSwitching(curves_[iter], generator, *regimes);
+				break;
+
+			case ModelOption::CORRELATED_ACCOUNTS:
+				generateAccountDraws(draws_[iter], generator);
+				break;
+
+			default:
+				generateRecessionRandomized(curves_[iter], generator);
+		}
+
+		/* Inflation is drawn after the growth, so that the growth curves
+		 * are the same with either inflation model */
+		if (inflation_ == InflationOption::STOCHASTIC) {
+			const std::array<float, MAX_YEARS>* market = nullptr;
+			if (model_ != ModelOption::CORRELATED_ACCOUNTS) {
+				market = &curves_[iter];
+			}
+			generateInflationPath(inflationPaths_[iter], generator, market);
+		}
+
+		/* And the bridges last, for the same reason */
+		if (step_ == StepOption::MONTHLY) {
+			generateMonthlyBridge(bridges_[iter], generator);
+		}
+
+		/* The death draw goes after everything else */
+		if (mortality_ == MortalityOption::LIFE_TABLE) {
+			deathDraws_[iter] = static_cast<uint32_t>(generator() >> 32);
+		}
+	};
+
+	if (pool != nullptr) {
+		pool->parallelFor(size_, generate);
+	}
+	else {
+		for (size_t iter = 0; iter < size_; iter++) {
+			generate(iter);
+		}
+	}
+}
+
+uint64_t ScenarioBank::seed() const
+{
+	return seed_;
+}
+
+ModelOption ScenarioBank::model() const
+{
+	return model_;
+}
+
+InflationOption ScenarioBank::inflation() const
+{
+	return inflation_;
+}
+
+TaxOption ScenarioBank::tax() const
+{
+	return tax_;
+}
+
+StepOption ScenarioBank::step() const
+{
+	return step_;
+}
+
+MortalityOption ScenarioBank::mortality() const
+{
+	return mortality_;
+}
+
+uint64_t ScenarioBank::first() const
+{
+	return first_;
+}
+
+size_t ScenarioBank::size() const
+{
+	return size_;
+}
+
+const std::array<float, MAX_YEARS>& ScenarioBank::operator[](size_t iteration) const
+{
+	return curves_[iteration];
+}
+
+const AccountDraws* ScenarioBank::draws(size_t iteration) const
+{
+	return draws_.data() + iteration;
+}
+
+const InflationPath& ScenarioBank::inflationPath(size_t iteration) const
+{
+	return inflationPaths_[iteration];
+}
+
+const MonthlyBridge& ScenarioBank::monthlyBridge(size_t iteration) const
+{
+	return bridges_[iteration];
+}
+
+uint32_t ScenarioBank::deathDraw(size_t iteration) const
+{
+	return deathDraws_[iteration];
+}
+
+uint64_t clockSeed()
+{
+	return ScenarioRng::mix(std::chrono::system_clock::now().time_since_epoch().count());
+}
@@ -0,0 +1,225 @@
+/* ============================================================================
+ * simServer.cpp
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Implementation of the SimServer class using POSIX sockets. Each client
+ *  connection is served by its own thread, which runs the NDJSON pipeline
+ *  between the socket and the shared thread pool.
+ *
+ *  Dependencies:
+ *    - simServer.h
+ *    - ndjsonStream.h
+ *
+ *  Created:    October 2026
+ *  Author:     Yuping X
+ * ============================================================================
+ */
+
+#include <iostream>
+#include <streambuf>
+#include <vector>
+#include <thread>
+#include <stdexcept>
+#include <cstring>
+#include <cerrno>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include "../include/simServer.h"
+#include "../include/ndjsonStream.h"
+
+/* Size of the read and write buffers of a connection */
+const size_t SERVER_BUFFER_BYTES = 64 * 1024;
+
+/**
+ * @brief Stream buffer over a socket, used in one direction only.
+ */
+class SocketStreamBuf : public std::streambuf {
+private:
+	int fd_;
+	std::vector<char> buffer_;
+
+	/* Writes the pending output; returns false on error */
+	bool writePending() {
+		const char* data = pbase();
+		size_t left = pptr() - pbase();
+		while (left > 0) {
+			ssize_t n = send(fd_, data, left, MSG_NOSIGNAL);
+			if (n < 0) {
+				if (errno == EINTR) {
+					continue;
+				}
+				return false;
+			}
+			data += n;
+			left -= n;
+		}
+		setp(buffer_.data(), buffer_.data() + buffer_.size());
+		return true;
+	}
+
+protected:
+	int_type underflow() override {
+		ssize_t n;
+		do {
+			n = recv(fd_, buffer_.data(), buffer_.size(), 0);
+		} while ((n < 0) && (errno == EINTR));
+		if (n <= 0) {
+			return traits_type::eof();
+		}
+		setg(buffer_.data(), buffer_.data(), buffer_.data() + n);
+		return traits_type::to_int_type(*gptr());
+	}
+
+	int_type overflow(int_type ch) override {
+		if (!writePending()) {
+			return traits_type::eof();
+		}
+		if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+			*pptr() = traits_type::to_char_type(ch);
+			pbump(1);
+		}
+		return traits_type::not_eof(ch);
+	}
+
+	int sync() override {
+		return writePending() ? 0 : -1;
+	}
+
+public:
+	explicit SocketStreamBuf(int fd) : fd_(fd), buffer_(SERVER_BUFFER_BYTES) {
+		setp(buffer_.data(), buffer_.data() + buffer_.size());
+	}
+};
+
+struct SimServer::Session {
+	int fd;
+	std::thread thread;
+	std::atomic<bool> done{false};
+};
+
+SimServer::SimServer(const std::string& socketPath, const ScenarioBank& bank, ThreadPool& pool,
+                     const StreamOptions& options)
+	: socketPath_(socketPath), bank_(bank), pool_(pool), options_(options),
+	  listenFd_(-1), stopping_(false)
+{
+	sockaddr_un address{};
+	address.sun_family = AF_UNIX;
+	if (socketPath.size() >= sizeof(address.sun_path)) {
+		throw std::runtime_error("Socket path is too long: " + socketPath);
+	}
+	std::strcpy(address.sun_path, socketPath.c_str());
+
+	if (pipe(wakeFd_) != 0) {
+		throw std::runtime_error(std::string("Could not create pipe: ") + std::strerror(errno));
+	}
+
+	listenFd_ = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+	if (listenFd_ < 0) {
+		close(wakeFd_[0]);
+		close(wakeFd_[1]);
+		throw std::runtime_error(std::string("Could not create socket: ") + std::strerror(errno));
+	}
+
+	/* Replace a socket file left behind by a server that did not exit
+	 * cleanly, but never any other kind of file */
+	struct stat st;
+	if ((lstat(socketPath.c_str(), &st) == 0) && S_ISSOCK(st.st_mode)) {
+		unlink(socketPath.c_str());
+	}
+
+	if ((bind(listenFd_, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) ||
+	    (listen(listenFd_, SERVER_LISTEN_BACKLOG) != 0)) {
+		std::string error = std::strerror(errno);
+		close(listenFd_);
+		close(wakeFd_[0]);
+		close(wakeFd_[1]);
+		throw std::runtime_error("Could not listen on " + socketPath + ": " + error);
+	}
+}
+
+SimServer::~SimServer()
+{
+	{
+		std::unique_lock<std::mutex> lock(sessionsMutex_);
+		for (std::unique_ptr<Session>& session : sessions_) {
+			shutdown(session->fd, SHUT_RDWR);
+		}
+	}
+	for (std::unique_ptr<Session>& session : sessions_) {
+		session->thread.join();
+		close(session->fd);
+	}
+
+	close(listenFd_);
+	close(wakeFd_[0]);
+	close(wakeFd_[1]);
+	unlink(socketPath_.c_str());
+}
+
+void SimServer::reapSessions()
+{
+	std::unique_lock<std::mutex> lock(sessionsMutex_);
+	for (auto it = sessions_.begin(); it != sessions_.end(); ) {
+		if ((*it)->done) {
+			(*it)->thread.join();
+			close((*it)->fd);
+			it = sessions_.erase(it);
+		}
+		else {
+			++it;
+		}
+	}
+}
+
+void SimServer::run()
+{
+	pollfd fds[2] = {{listenFd_, POLLIN, 0}, {wakeFd_[0], POLLIN, 0}};
+
+	while (!stopping_) {
+		if (poll(fds, 2, -1) < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			throw std::runtime_error(std::string("Could not wait for connections: ") + std::strerror(errno));
+		}
+		if (stopping_ || !(fds[0].revents & POLLIN)) {
+			continue;
+		}
+
+		int fd = accept4(listenFd_, nullptr, nullptr, SOCK_CLOEXEC);
+		if (fd < 0) {
+			continue;
+		}
+
+		reapSessions();
+
+		auto session = std::make_unique<Session>();
+		Session* s = session.get();
+		s->fd = fd;
+		s->thread = std::thread([this, s] {
+			SocketStreamBuf inBuf(s->fd);
+			SocketStreamBuf outBuf(s->fd);
+			std::istream in(&inBuf);
+			std::ostream out(&outBuf);
+			runNdjsonStream(in, out, bank_, pool_, options_);
+			shutdown(s->fd, SHUT_WR);
+			s->done = true;
+		});
+
+		std::unique_lock<std::mutex> lock(sessionsMutex_);
+		sessions_.push_back(std::move(session));
+	}
+}
+
+void SimServer::stop()
+{
+	stopping_ = true;
+	char wake = 0;
+	ssize_t ignored = write(wakeFd_[1], &wake, 1);
+	(void) ignored;
+}
@@ -0,0 +1,335 @@
+/* ============================================================================
+ * studyRun.cpp
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Implements long Monte Carlo studies and their checkpoint files.
+ *
+ *  Dependencies:
+ *    - studyRun.h
+ *    - resultCache.h (canonical records, model hash)
+ *    - profileBinary.h (checksum)
+ *
+ *  Created:    October 2026
+ *  Author:     Yuping X
+ * ============================================================================
+ */
+
+#include <fstream>
+#include <iostream>
+#include <cstring>
+#include <cstdio>
+#include <algorithm>
+#include <stdexcept>
+#include "../include/studyRun.h"
+#include "../include/scenarioBank.h"
+#include "../include/resultCache.h"
+#include "../include/profileBinary.h"
+
+/* Fewest scenarios simulated by one task of a block */
+static const size_t STUDY_MIN_SLICE = 1024;
+
+uint64_t studyProfileHash(const UserData& user) {
+	ProfileRecord record;
+	canonicalRecord(user, record);
+	return profileChecksum(&record, sizeof(record));
+}
+
+StudyState initStudy(const std::vector<UserData>& profiles, uint64_t seed,
+                     uint64_t totalIterations, uint64_t firstIteration, uint64_t endIteration,
+                     ModelOption model, InflationOption inflation, TaxOption tax, StepOption step,
+                     MortalityOption mortality) {
+	StudyState state;
+	state.seed = seed;
+	state.model = model;
+	state.inflation = inflation;
+	state.tax = tax;
+	state.step = step;
+	state.mortality = mortality;
+	state.modelHash = scenarioModelHash(model, inflation, tax, step, mortality);
+	state.totalIterations = totalIterations;
+	state.firstIteration = firstIteration;
+	state.endIteration = endIteration;
+	state.nextIteration = firstIteration;
+
+	/* An empty bank runs the deterministic models only */
+	ScenarioBank noScenarios(seed, 0, nullptr, model, inflation, tax, step, mortality);
+	for (const UserData& user : profiles) {
+		state.profileHashes.push_back(studyProfileHash(user));
+		state.results.push_back(simulateProfile(user, noScenarios));
+	}
+	return state;
+}
+
+void checkStudyProfiles(const StudyState& state, const std::vector<UserData>& profiles) {
+	if (state.modelHash != scenarioModelHash(state.model, state.inflation, state.tax, state.step,
+	                                         state.mortality)) {
+		throw std::runtime_error("The study was run with other simulation models; start it over");
+	}
+	if (state.profileHashes.size() != profiles.size()) {
+		throw std::runtime_error("The study has " + std::to_string(state.profileHashes.size()) + \
+		                         " profile(s), but " + std::to_string(profiles.size()) + " were given");
+	}
+	for (size_t i = 0; i < profiles.size(); i++) {
+		if (state.profileHashes[i] != studyProfileHash(profiles[i])) {
+			throw std::runtime_error("Profile " + profiles[i].profileId + \
+			                         " differs from profile " + std::to_string(i + 1) + " of the study");
+		}
+	}
+}
+
+void runStudy(const std::vector<UserData>& profiles, StudyState& state, ThreadPool& pool,
+              const std::string& checkpointFile, unsigned int checkpointSeconds,
+              std::ostream* progress) {
+	checkStudyProfiles(state, profiles);
+	if (profiles.empty()) {
+		/* Nothing to simulate, nor to split into slices */
+		return;
+	}
+
+	SimClock::time_point lastCheckpoint = SimClock::now();
+	while (state.nextIteration < state.endIteration) {
+		unsigned int count = static_cast<unsigned int>(
+			std::min<uint64_t>(STUDY_BLOCK_SCENARIOS, state.endIteration - state.nextIteration));
+		ScenarioBank block(state.seed, state.nextIteration, count, &pool, state.model, state.inflation,
+		                   state.tax, state.step, state.mortality);
+
+		/* Split each profile's block into slices so that a few profiles
+		 * still keep every worker busy */
+		size_t tasksWanted = 4 * static_cast<size_t>(pool.size());
+		size_t slices = std::max<size_t>(1, (tasksWanted + profiles.size() - 1) / profiles.size());
+		slices = std::min(slices, std::max<size_t>(1, count / STUDY_MIN_SLICE));
+
+		std::vector<SimResult> parts(profiles.size() * slices, SimResult{});
+		pool.parallelFor(parts.size(), [&](size_t task) {
+			size_t profile = task / slices;
+			size_t slice = task % slices;
+			size_t begin = count * slice / slices;
+			size_t end = count * (slice + 1) / slices;
+			simulateScenarios(profiles[profile], block, begin, end, parts[task]);
+		});
+
+		for (size_t task = 0; task < parts.size(); task++) {
+			mergeSimResult(state.results[task / slices], parts[task]);
+		}
+		state.nextIteration += count;
+
+		bool finished = (state.nextIteration == state.endIteration);
+		if (!checkpointFile.empty() && (finished || \
+		    (SimClock::now() - lastCheckpoint >= std::chrono::seconds(checkpointSeconds)))) {
+			writeStudyState(checkpointFile, state);
+			lastCheckpoint = SimClock::now();
+			if (progress != nullptr) {
+				*progress << "Checkpoint: " << (state.nextIteration - state.firstIteration) \
+				          << " of " << (state.endIteration - state.firstIteration) \
+				          << " iterations saved to " << checkpointFile << std::endl;
+			}
+		}
+	}
+}
+
+void shardRange(uint64_t totalIterations, uint64_t index, uint64_t count,
+                uint64_t& first, uint64_t& end) {
+	/* 128-bit products so that huge runs cannot overflow */
+	first = static_cast<uint64_t>(static_cast<unsigned __int128>(totalIterations) * index / count);
+	end = static_cast<uint64_t>(static_cast<unsigned __int128>(totalIterations) * (index + 1) / count);
+}
+
+StudyState mergeStudyStates(const std::vector<StudyState>& shards) {
+	if (shards.empty()) {
+		throw std::runtime_error("No shards to merge");
+	}
+
+	std::vector<const StudyState*> ordered;
+	for (const StudyState& shard : shards) {
+		ordered.push_back(&shard);
+	}
+	std::sort(ordered.begin(), ordered.end(), [](const StudyState* a, const StudyState* b) {
+		return a->firstIteration < b->firstIteration;
+	});
+
+	const StudyState& base = *ordered.front();
+	StudyState merged = base;
+	merged.firstIteration = 0;
+	merged.endIteration = 0;
+	for (SimResult& result : merged.results) {
+		result.iterations = 0;
+		result.longevityCounts.fill(0);
+	}
+
+	for (const StudyState* shard : ordered) {
+		if ((shard->seed != base.seed) || (shard->totalIterations != base.totalIterations) || \
+		    (shard->modelHash != base.modelHash) || (shard->profileHashes != base.profileHashes)) {
+			throw std::runtime_error("The shards are not all of the same run");
+		}
+		if (shard->nextIteration != shard->endIteration) {
+			throw std::runtime_error("The shard of iterations " + std::to_string(shard->firstIteration) + \
+			                         "-" + std::to_string(shard->endIteration) + " is not finished");
+		}
+		if (shard->firstIteration != merged.endIteration) {
+			throw std::runtime_error("The shards do not cover iterations " + \
+			                         std::to_string(merged.endIteration) + "-" + \
+			                         std::to_string(shard->firstIteration) + " exactly once");
+		}
+		for (size_t i = 0; i < merged.results.size(); i++) {
+			mergeSimResult(merged.results[i], shard->results[i]);
+		}
+		merged.endIteration = shard->endIteration;
+	}
+
+	if (merged.endIteration != merged.totalIterations) {
+		throw std::runtime_error("The shards end at iteration " + std::to_string(merged.endIteration) + \
+		                         " of " + std::to_string(merged.totalIterations));
+	}
+	merged.nextIteration = merged.endIteration;
+	return merged;
+}
+
+void writeStudyState(const std::string& filename, const StudyState& state) {
+	std::vector<StudyProfileRecord> records(state.results.size());
+	for (size_t i = 0; i < records.size(); i++) {
+		const SimResult& result = state.results[i];
+		StudyProfileRecord& record = records[i];
+		std::memset(&record, 0, sizeof(record));
+		record.profileHash = state.profileHashes[i];
+		std::memcpy(record.profileId, result.profileId.data(),
+		            std::min<size_t>(result.profileId.size(), STUDY_ID_SIZE - 1));
+		std::copy(result.longevityCounts.begin(), result.longevityCounts.end(), record.longevityCounts);
+		record.iterations = result.iterations;
+		record.predefinedLongevity = result.predefinedLongevity;
+		record.constantLongevity = result.constantLongevity;
+	}
+
+	StudyStateHeader header;
+	std::memset(&header, 0, sizeof(header));
+	std::memcpy(header.magic, STUDY_STATE_MAGIC, sizeof(header.magic));
+	header.version = STUDY_STATE_VERSION;
+	header.recordSize = sizeof(StudyProfileRecord);
+	header.profileCount = static_cast<uint32_t>(records.size());
+	header.model = static_cast<uint32_t>(state.model);
+	header.inflation = static_cast<uint32_t>(state.inflation);
+	header.tax = static_cast<uint32_t>(state.tax);
+	header.step = static_cast<uint32_t>(state.step);
+	header.mortality = static_cast<uint32_t>(state.mortality);
+	header.seed = state.seed;
+	header.modelHash = state.modelHash;
+	header.totalIterations = state.totalIterations;
+	header.firstIteration = state.firstIteration;
+	header.endIteration = state.endIteration;
+	header.nextIteration = state.nextIteration;
+	header.checksum = profileChecksum(records.data(), records.size() * sizeof(StudyProfileRecord));
+
+	/* Write a new file and rename it over the old one, so that a crash
+	 * never leaves a partially written checkpoint behind */
+	std::string tempname = filename + ".tmp";
+	{
+		std::ofstream file(tempname, std::ios::binary | std::ios::trunc);
+		if (!file.is_open()) {
+			throw std::runtime_error("Could not open " + tempname + " for writing");
+		}
+		file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		file.write(reinterpret_cast<const char*>(records.data()),
+		           records.size() * sizeof(StudyProfileRecord));
+		file.flush();
+		if (!file) {
+			throw std::runtime_error("Could not write the study state to " + tempname);
+		}
+	}
+	if (std::rename(tempname.c_str(), filename.c_str()) != 0) {
+		throw std::runtime_error("Could not replace " + filename + " with " + tempname);
+	}
+}
+
+StudyState readStudyState(const std::string& filename) {
+	std::ifstream file(filename, std::ios::binary);
+	if (!file.is_open()) {
+		throw std::runtime_error("Could not open " + filename);
+	}
+
+	StudyStateHeader header;
+	if (!file.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+		throw std::runtime_error(filename + " is too small to be a study state file");
+	}
+	if (std::memcmp(header.magic, STUDY_STATE_MAGIC, sizeof(header.magic)) != 0) {
+		throw std::runtime_error(filename + " is not a study state file");
+	}
+	if (header.version != STUDY_STATE_VERSION) {
+		throw std::runtime_error(filename + " has study format version " + \
+		                         std::to_string(header.version) + ", expected " + \
+		                         std::to_string(STUDY_STATE_VERSION));
+	}
+	if (header.recordSize != sizeof(StudyProfileRecord)) {
+		throw std::runtime_error(filename + " has an unexpected record size");
+	}
+
+	/* The count is untrusted: check it against the size of the file
+	 * before allocating the records */
+	std::streamoff start = file.tellg();
+	file.seekg(0, std::ios::end);
+	uint64_t body = static_cast<uint64_t>(file.tellg() - start);
+	file.seekg(start);
+	if (header.profileCount != body / sizeof(StudyProfileRecord)) {
+		throw std::runtime_error(filename + " has an unexpected size");
+	}
+
+	std::vector<StudyProfileRecord> records(header.profileCount);
+	file.read(reinterpret_cast<char*>(records.data()), records.size() * sizeof(StudyProfileRecord));
+	if (!file || (file.peek() != std::ifstream::traits_type::eof())) {
+		throw std::runtime_error(filename + " has an unexpected size");
+	}
+	if (profileChecksum(records.data(), records.size() * sizeof(StudyProfileRecord)) != header.checksum) {
+		throw std::runtime_error(filename + " failed its checksum; the file is corrupted");
+	}
+	if ((header.firstIteration > header.nextIteration) || (header.nextIteration > header.endIteration) || \
+	    (header.endIteration > header.totalIterations)) {
+		throw std::runtime_error(filename + " has an inconsistent iteration range");
+	}
+
+	if ((header.model > static_cast<uint32_t>(ModelOption::MAX)) || \
+	    !isRandomizedModel(static_cast<ModelOption>(header.model))) {
+		throw std::runtime_error(filename + " has an unknown randomized model");
+	}
+	if (header.inflation > static_cast<uint32_t>(InflationOption::MAX)) {
+		throw std::runtime_error(filename + " has an unknown inflation model");
+	}
+	if (header.tax > static_cast<uint32_t>(TaxOption::MAX)) {
+		throw std::runtime_error(filename + " has an unknown tax model");
+	}
+	if (header.step > static_cast<uint32_t>(StepOption::MAX)) {
+		throw std::runtime_error(filename + " has an unknown time step");
+	}
+	if (header.mortality > static_cast<uint32_t>(MortalityOption::MAX)) {
+		throw std::runtime_error(filename + " has an unknown mortality model");
+	}
+
+	StudyState state;
+	state.seed = header.seed;
+	state.model = static_cast<ModelOption>(header.model);
+	state.inflation = static_cast<InflationOption>(header.inflation);
+	state.tax = static_cast<TaxOption>(header.tax);
+	state.step = static_cast<StepOption>(header.step);
+	state.mortality = static_cast<MortalityOption>(header.mortality);
+	state.modelHash = header.modelHash;
+	state.totalIterations = header.totalIterations;
+	state.firstIteration = header.firstIteration;
+	state.endIteration = header.endIteration;
+	state.nextIteration = header.nextIteration;
+	for (const StudyProfileRecord& record : records) {
+		SimResult result{};
+		result.profileId = std::string(record.profileId, strnlen(record.profileId, STUDY_ID_SIZE));
+		result.seed = header.seed;
+		result.model = state.model;
+		result.inflation = state.inflation;
+		result.tax = state.tax;
+		result.step = state.step;
+		result.mortality = state.mortality;
+		result.iterations = record.iterations;
+		std::copy(record.longevityCounts, record.longevityCounts + MAX_YEARS + 1,
+		          result.longevityCounts.begin());
+		result.predefinedLongevity = record.predefinedLongevity;
+		result.constantLongevity = record.constantLongevity;
+		state.profileHashes.push_back(record.profileHash);
+		state.results.push_back(std::move(result));
+	}
+	return state;
+}
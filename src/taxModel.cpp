@@ -0,0 +1,145 @@
+/* ============================================================================
+ * taxModel.cpp
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Implements the loading of the federal income tax brackets.
+ *
+ *  Dependencies:
+ *    - taxModel.h
+ *    - userDataLoading.h (parsing helpers)
+ *    - profileBinary.h (checksum)
+ *
+ *  Created:    October 2026
+ *  Author:     Yuping X
+ * ============================================================================
+ */
+
+#include <fstream>
+#include <map>
+#include <vector>
+#include <limits>
+#include <stdexcept>
+#include "../include/taxModel.h"
+#include "../include/userDataLoading.h"
+#include "../include/profileBinary.h"
+
+TaxTable::TaxTable(const std::string& filename)
+	: checksum_(0)
+{
+	std::ifstream file(filename);
+	if (!file.is_open()) {
+		throw std::runtime_error("Could not open tax table " + filename);
+	}
+
+	/* Read all Key = value lines */
+	std::map<std::string, std::string> values;
+	std::string line;
+	size_t lineNum = 0;
+	while (std::getline(file, line)) {
+		lineNum++;
+		std::string_view row = trim(line);
+		if (row.empty() || (row.front() == '#')) {
+			continue;
+		}
+		size_t equals = row.find('=');
+		if (equals == std::string_view::npos) {
+			throw std::runtime_error(filename + ":" + std::to_string(lineNum) + ": expected Key = value");
+		}
+		values[std::string(trim(row.substr(0, equals)))] = std::string(trim(row.substr(equals + 1)));
+	}
+
+	auto lookup = [&](const std::string& key) -> const std::string& {
+		auto it = values.find(key);
+		if (it == values.end()) {
+			throw std::runtime_error(filename + ": missing " + key);
+		}
+		return it->second;
+	};
+
+	std::vector<double> parameters;
+
+	float deduction = 0;
+	if ((parseNumber(lookup("Deduction"), deduction) != std::errc()) || (deduction < 0)) {
+		throw std::runtime_error(filename + ": invalid Deduction");
+	}
+	parameters.push_back(deduction);
+
+	/* Reads the brackets of a kind, after the one of the deduction */
+	auto loadBrackets = [&](const std::string& key, auto& brackets) {
+		const size_t lanes = brackets.start.size();
+		std::vector<std::string_view> fields = splitList(lookup(key));
+		if (fields.size() >= lanes) {
+			throw std::runtime_error(filename + ": " + key + " lists more than " + \
+			                         std::to_string(lanes - 1) + " brackets");
+		}
+		brackets.start.fill(std::numeric_limits<float>::max());
+		brackets.rate.fill(0.0f);
+		brackets.base.fill(0.0f);
+		brackets.start[0] = 0.0f;
+
+		for (size_t k = 0; k < fields.size(); k++) {
+			size_t colon = fields[k].find(':');
+			float start = 0;
+			float rate = 0;
+			if ((colon == std::string_view::npos) || \
+			    (parseNumber(trim(fields[k].substr(0, colon)), start) != std::errc()) || \
+			    (parseNumber(trim(fields[k].substr(colon + 1)), rate) != std::errc()) || \
+			    (rate < 0.0f) || (rate >= 1.0f)) {
+				throw std::runtime_error(filename + ": invalid start:rate pair in " + key);
+			}
+			if ((k == 0) ? (start != 0.0f) : (start + deduction <= brackets.start[k])) {
+				throw std::runtime_error(filename + ": " + key + \
+				                         " must start at 0 and list the brackets by increasing start");
+			}
+			brackets.start[k + 1] = start + deduction;
+			brackets.rate[k + 1] = rate;
+			brackets.base[k + 1] = brackets.base[k] + \
+			                       brackets.rate[k] * (brackets.start[k + 1] - brackets.start[k]);
+			parameters.push_back(start);
+			parameters.push_back(rate);
+		}
+
+		/* Unused brackets are never reached, but keep the last tax */
+		for (size_t k = fields.size() + 1; k < lanes; k++) {
+			brackets.base[k] = brackets.base[k - 1];
+		}
+	};
+
+	loadBrackets("Ordinary-brackets", ordinary_);
+	loadBrackets("Gains-brackets", gains_);
+	checksum_ = profileChecksum(parameters.data(), parameters.size() * sizeof(double));
+}
+
+const TaxTable& TaxTable::shared()
+{
+	static const TaxTable table(TAX_TABLE_FILE);
+	return table;
+}
+
+uint64_t TaxTable::checksum() const
+{
+	return checksum_;
+}
+
+template <unsigned int LANES>
+float TaxTable::Brackets<LANES>::tax(float income) const
+{
+	/* Every start is compared, so that the comparisons fill whole vector
+	 * lanes; the first start is 0 and always reached */
+	unsigned int reached = 0;
+	for (unsigned int k = 0; k < LANES; k++) {
+		reached += (income >= start[k]);
+	}
+	unsigned int bracket = reached - 1;
+	return base[bracket] + rate[bracket] * (income - start[bracket]);
+}
+
+/* Kept out of line: inlined into the year loop of a path, the comparisons
+ * are unrolled before they can be vectorized */
+float TaxTable::tax(float ordinary, float gains) const
+{
+	/* Gains fill the gains brackets from the top of the ordinary income up */
+	return ordinary_.tax(ordinary) + gains_.tax(ordinary + gains) - gains_.tax(ordinary);
+}
+
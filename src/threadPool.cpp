@@ -0,0 +1,133 @@
+/* ============================================================================
+ * threadPool.cpp
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Implementation of the ThreadPool class.
+ *
+ *  Dependencies:
+ *    - threadPool.h
+ *
+ *  Created:    October 2026
+ *  Author:     Yuping X
+ * ============================================================================
+ */
+
+#include <algorithm>
+#include <exception>
+#include "../include/threadPool.h"
+
+/* Number of blocks parallelFor() splits its range into per worker, so that
+ * uneven work still balances */
+const size_t BLOCKS_PER_WORKER = 4;
+
+ThreadPool::ThreadPool(unsigned int threads)
+{
+	pending_ = 0;
+	stopping_ = false;
+
+	if (threads == 0) {
+		threads = std::max(1u, std::thread::hardware_concurrency());
+	}
+	for (unsigned int t = 0; t < threads; t++) {
+		workers_.emplace_back(&ThreadPool::workerLoop, this);
+	}
+}
+
+ThreadPool::~ThreadPool()
+{
+	{
+		std::unique_lock<std::mutex> lock(mutex_);
+		stopping_ = true;
+	}
+	taskAvailable_.notify_all();
+	for (std::thread& worker : workers_) {
+		worker.join();
+	}
+}
+
+unsigned int ThreadPool::size() const
+{
+	return static_cast<unsigned int>(workers_.size());
+}
+
+void ThreadPool::workerLoop()
+{
+	while (true) {
+		std::function<void()> task;
+		{
+			std::unique_lock<std::mutex> lock(mutex_);
+			taskAvailable_.wait(lock, [this] { return stopping_ || !tasks_.empty(); });
+			if (tasks_.empty()) {
+				return;
+			}
+			task = std::move(tasks_.front());
+			tasks_.pop_front();
+		}
+
+		task();
+
+		{
+			std::unique_lock<std::mutex> lock(mutex_);
+			if (--pending_ == 0) {
+				allDone_.notify_all();
+			}
+		}
+	}
+}
+
+void ThreadPool::submit(std::function<void()> task)
+{
+	{
+		std::unique_lock<std::mutex> lock(mutex_);
+		tasks_.push_back(std::move(task));
+		pending_++;
+	}
+	taskAvailable_.notify_one();
+}
+
+void ThreadPool::wait()
+{
+	std::unique_lock<std::mutex> lock(mutex_);
+	allDone_.wait(lock, [this] { return pending_ == 0; });
+}
+
+void ThreadPool::parallelFor(size_t count, const std::function<void(size_t)>& body)
+{
+	/* Track this call's own blocks, so that it does not wait for (or get
+	 * confused by) tasks that other callers submitted to the pool */
+	size_t blocks = std::min(count, workers_.size() * BLOCKS_PER_WORKER);
+	size_t remaining = blocks;
+	std::exception_ptr error;
+	std::mutex doneMutex;
+	std::condition_variable done;
+
+	for (size_t b = 0; b < blocks; b++) {
+		size_t begin = count * b / blocks;
+		size_t end = count * (b + 1) / blocks;
+		submit([begin, end, &body, &remaining, &error, &doneMutex, &done] {
+			std::exception_ptr blockError;
+			try {
+				for (size_t i = begin; i < end; i++) {
+					body(i);
+				}
+			} catch (...) {
+				blockError = std::current_exception();
+			}
+
+			std::unique_lock<std::mutex> lock(doneMutex);
+			if (blockError && !error) {
+				error = blockError;
+			}
+			if (--remaining == 0) {
+				done.notify_all();
+			}
+		});
+	}
+
+	std::unique_lock<std::mutex> lock(doneMutex);
+	done.wait(lock, [&remaining] { return remaining == 0; });
+	if (error) {
+		std::rethrow_exception(error);
+	}
+}
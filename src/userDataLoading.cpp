@@ -10,14 +10,19 @@
  *
  *  Key Function:
  *    - loadUserFinancialProfile: Populates the UserData structure from file
- *      input, organizing parameters by section (e.g., [Assets], [General]).
+ *      input, organizing parameters by section (e.g., [Assets], [General],
+ *      [Covariance], [Events]).
  *    - userDataWithinBounds: Check if user data is within bounds.
  *    - displayUserInfo: Prints loaded data for inspection
  *
  *  Dependencies:
  *    - userDataLoading.h
  *    - constants.h
- *    - C++ STL (iostream, fstream, sstream, string)
+ *    - modelCorrelated.h (covariance check)
+ *    - rmdTable.h (birth year bounds)
+ *    - modelMortality.h (sex bounds)
+ *    - spendingPolicy.h (spending rule names)
+ *    - C++ STL (iostream, fstream, string_view, charconv)
  *
  *  Usage Context:
  *    Called during simulation initialization to prepare user-specific
@@ -30,32 +35,312 @@
 
 #include <iostream>
 #include <fstream>
-#include <sstream>
 #include <string>
 #include <string_view>
-#include <unordered_map>
-#include <functional>
+#include <vector>
+#include <array>
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <stdexcept>
 #include "../include/userDataLoading.h"
 #include "../include/constants.h"
+#include "../include/modelCorrelated.h"
+#include "../include/rmdTable.h"
+#include "../include/modelMortality.h"
+#include "../include/spendingPolicy.h"
+
+/* =========================================================================
+ * Compile-time Perfect Hash of the General Section Keys
+ * ========================================================================= */
+
+/* Keys of the [General] section. The order must match GeneralKey. */
+constexpr std::array<std::string_view, static_cast<int>(GeneralKey::COUNT)> GENERAL_KEYS = {
+    "Cost-of-living",
+    "Current-annual-takehome-income",
+    "Current-annual-roth-contribution",
+    "Current-annual-ira-contribution",
+    "Current-annual-r401k-contribution",
+    "Pension-estimate",
+    "Inflation",
+    "Years-till-retirement",
+    "Years-till-withdrawal",
+    "Years-till-pension",
+    "Birth-year",
+    "Cash-reserve-years",
+    "Cash-reserve-refill",
+    "Sex",
+    "Spending-rule"
+};
+
+/* Number of slots in the hash table; a power of 2 above the key count */
+constexpr uint32_t GENERAL_TABLE_SIZE = 64;
+
+/* Seeded FNV-1a hash */
+constexpr uint32_t hashKey(std::string_view key, uint32_t seed) {
+    uint32_t h = 2166136261u ^ seed;
+    for (char ch : key) {
+        h = (h ^ static_cast<unsigned char>(ch)) * 16777619u;
+    }
+    return h;
+}
+
+/* Search for a seed that maps every key to a distinct slot */
+constexpr uint32_t findGeneralSeed() {
+    for (uint32_t seed = 0; seed < 100000; seed++) {
+        std::array<bool, GENERAL_TABLE_SIZE> used{};
+        bool collision = false;
+        for (std::string_view key : GENERAL_KEYS) {
+            uint32_t slot = hashKey(key, seed) & (GENERAL_TABLE_SIZE - 1);
+            if (used[slot]) {
+                collision = true;
+                break;
+            }
+            used[slot] = true;
+        }
+        if (!collision) {
+            return seed;
+        }
+    }
+    return UINT32_MAX;
+}
+
+constexpr uint32_t GENERAL_SEED = findGeneralSeed();
+static_assert(GENERAL_SEED != UINT32_MAX, "No perfect hash seed found for the General section keys");
+
+/* Slot to key index table; -1 marks an empty slot */
+constexpr std::array<int, GENERAL_TABLE_SIZE> buildGeneralTable() {
+    std::array<int, GENERAL_TABLE_SIZE> table{};
+    for (uint32_t slot = 0; slot < GENERAL_TABLE_SIZE; slot++) {
+        table[slot] = -1;
+    }
+    for (int k = 0; k < static_cast<int>(GENERAL_KEYS.size()); k++) {
+        table[hashKey(GENERAL_KEYS[k], GENERAL_SEED) & (GENERAL_TABLE_SIZE - 1)] = k;
+    }
+    return table;
+}
+
+constexpr std::array<int, GENERAL_TABLE_SIZE> GENERAL_TABLE = buildGeneralTable();
+
+/* Returns the GeneralKey of a key name, or GeneralKey::COUNT if unknown */
+GeneralKey lookupGeneralKey(std::string_view key) {
+    int k = GENERAL_TABLE[hashKey(key, GENERAL_SEED) & (GENERAL_TABLE_SIZE - 1)];
+    if ((k < 0) || (GENERAL_KEYS[k] != key)) {
+        return GeneralKey::COUNT;
+    }
+    return static_cast<GeneralKey>(k);
+}
+
+/* =========================================================================
+ * Tokenizing and Number Parsing Helpers
+ * ========================================================================= */
 
 /* Helper function to trim blank spaces at the beginning and end of a string */
-static std::string_view trim(const std::string_view s) {
+std::string_view trim(std::string_view s) {
     size_t start = 0;
-    size_t end = s.size() - 1;
-    while ((start < end) && (s[start] == ' ')) {
-            start++;
+    size_t end = s.size();
+    while ((start < end) && ((s[start] == ' ') || (s[start] == '\t'))) {
+        start++;
     }
-
-    while ((end > start) && (s[end] == ' '))  {
+    while ((end > start) && ((s[end - 1] == ' ') || (s[end - 1] == '\t') || (s[end - 1] == '\r'))) {
         end--;
     }
-    return(s.substr(start, end - start + 1));
+    return s.substr(start, end - start);
+}
+
+std::vector<std::string_view> splitList(std::string_view list) {
+    std::vector<std::string_view> fields;
+    size_t start = 0;
+    while (true) {
+        size_t comma = list.find(',', start);
+        fields.push_back(trim(list.substr(start, comma - start)));
+        if (comma == std::string_view::npos) {
+            return fields;
+        }
+        start = comma + 1;
+    }
+}
+
+/* Parses value into the UserData field identified by generalKey */
+std::errc parseGeneralValue(UserData& user, GeneralKey generalKey, std::string_view value) {
+    if (generalKey == GeneralKey::INFLATION) {
+        return parseNumber(value, user.initialInflation);
+    }
+    if (generalKey == GeneralKey::CASH_RESERVE_YEARS) {
+        return parseNumber(value, user.cashReserveYears);
+    }
+    if (generalKey == GeneralKey::CASH_RESERVE_REFILL) {
+        return parseNumber(value, user.cashReserveRefill);
+    }
+    if (generalKey == GeneralKey::SPENDING_RULE) {
+        /* By name, or by code as in streamed profiles */
+        for (unsigned short rule = 0; rule <= static_cast<unsigned short>(SpendingRule::MAX); rule++) {
+            if (value == SPENDING_RULE_NAMES[rule]) {
+                user.spendingRule = rule;
+                return std::errc();
+            }
+        }
+        return parseNumber(value, user.spendingRule);
+    }
+
+    int number = 0;
+    std::errc ec = parseNumber(value, number);
+    if (ec != std::errc()) {
+        return ec;
+    }
+
+    switch (generalKey) {
+        case GeneralKey::COST_OF_LIVING:        user.initialExpense = number; break;
+        case GeneralKey::TAKEHOME_INCOME:       user.takehomeIncome = number; break;
+        case GeneralKey::ROTH_CONTRIBUTION:     user.contributionRoth = number; break;
+        case GeneralKey::IRA_CONTRIBUTION:      user.contributionIra = number; break;
+        case GeneralKey::R401K_CONTRIBUTION:    user.contributionR401k = number; break;
+        case GeneralKey::PENSION_ESTIMATE:      user.pensionEstimate = number; break;
+        case GeneralKey::YEARS_TILL_RETIREMENT: user.yearsTillRetirement = static_cast<unsigned short>(number); break;
+        case GeneralKey::YEARS_TILL_WITHDRAWAL: user.yearsTillWithdrawal = static_cast<unsigned short>(number); break;
+        case GeneralKey::YEARS_TILL_PENSION:    user.yearsTillPension = static_cast<unsigned short>(number); break;
+        case GeneralKey::BIRTH_YEAR:            user.birthYear = static_cast<unsigned short>(number); break;
+        case GeneralKey::SEX:                   user.sex = static_cast<unsigned short>(number); break;
+        default: return std::errc::invalid_argument;
+    }
+    return std::errc();
+}
+
+/* Builds a " on line L, column C" location suffix for error messages */
+static std::string location(size_t lineNum, std::string_view line, std::string_view token) {
+    return " on line " + std::to_string(lineNum) + ", column " + \
+           std::to_string(token.data() - line.data() + 1);
+}
+
+/* Drops one leading '+' of a profile number: the original parsers of INI
+ * profiles (std::stoi, std::stof) accept it, while std::from_chars does not */
+static std::string_view withoutPlusSign(std::string_view s) {
+    if ((s.size() > 1) && (s[0] == '+') && (s[1] != '+') && (s[1] != '-')) {
+        s.remove_prefix(1);
+    }
+    return s;
+}
+
+/* Parses one key = value line of the [General] section into user */
+static void parseGeneralLine(UserData& user, std::string_view line, size_t lineNum,
+                             std::string_view key, std::string_view value) {
+    GeneralKey generalKey = lookupGeneralKey(key);
+    if (generalKey == GeneralKey::COUNT) {
+        throw std::runtime_error("Unknown key in General section" + location(lineNum, line, key) + \
+                                 ": " + std::string(key));
+    }
+
+    std::errc ec = parseGeneralValue(user, generalKey, withoutPlusSign(value));
+    if (ec != std::errc()) {
+        throw std::runtime_error("Error parsing value for '" + std::string(key) + "'" + \
+                                 location(lineNum, line, value) + ": " + \
+                                 ((ec == std::errc::result_out_of_range) ? "out of range" : "not a number"));
+    }
+}
+
+/* Parses one name = value, rate line of the [Assets] section into user */
+static void parseAssetLine(UserData& user, short index, std::string_view line, size_t lineNum,
+                           std::string_view key, std::string_view value) {
+    size_t comma = value.find(',');
+    std::string_view valueField = trim(value.substr(0, comma));
+    std::string_view rateField = (comma == std::string_view::npos) ? \
+                                 value.substr(value.size()) : trim(value.substr(comma + 1));
+
+    std::errc ec = parseNumber(withoutPlusSign(valueField), user.value[index]);
+    std::string_view badField = valueField;
+    if (ec == std::errc()) {
+        ec = parseNumber(withoutPlusSign(rateField), user.rate[index]);
+        badField = rateField;
+    }
+
+    if (ec == std::errc::result_out_of_range) {
+        throw std::runtime_error("Out-of-range number" + location(lineNum, line, badField) + \
+                                 " '" + std::string(line) + "'");
+    }
+    else if (ec != std::errc()) {
+        throw std::runtime_error("Invalid format" + location(lineNum, line, badField) + \
+                                 " '" + std::string(line) + "': expected <value>, <rate>");
+    }
+    user.name[index] = key;
+}
+
+/* Parses one name = cov_1, ..., cov_n line of the [Covariance] section into
+ * row index of the covariance matrix of user */
+static void parseCovarianceLine(UserData& user, short index, std::string_view line, size_t lineNum,
+                                std::string_view value) {
+    for (int c = 0; c < MAX_ACCOUNTS; c++) {
+        size_t comma = value.find(',');
+        std::string_view field = trim(value.substr(0, comma));
+        std::errc ec = parseNumber(field, user.covariance[index][c]);
+        if ((ec == std::errc()) && ((comma == std::string_view::npos) != (c == MAX_ACCOUNTS - 1))) {
+            ec = std::errc::invalid_argument;
+        }
+        if (ec != std::errc()) {
+            throw std::runtime_error("Invalid format" + location(lineNum, line, field) + \
+                                     " '" + std::string(line) + "': expected " + \
+                                     std::to_string(MAX_ACCOUNTS) + " covariances");
+        }
+        value = (comma == std::string_view::npos) ? value.substr(value.size()) : value.substr(comma + 1);
+    }
+}
+
+/* Number of fields of an [Events] line: amount, first year, number of
+ * years and years between them */
+const int EVENT_FIELDS = 4;
+
+/* Parses one name = amount, first[, years[, every]] line of the [Events]
+ * section and adds the amount to every year of the event. Events are
+ * compiled here into one expense per year, so the simulation never sees
+ * them one by one. */
+static void parseEventLine(UserData& user, std::string_view line, size_t lineNum,
+                           std::string_view value) {
+    /* The last two fields default to a single year */
+    int field[EVENT_FIELDS] = {0, 0, 1, 1};
+    int count = 0;
+    while (true) {
+        size_t comma = value.find(',');
+        std::string_view token = trim(value.substr(0, comma));
+        std::errc ec = (count < EVENT_FIELDS) ? parseNumber(token, field[count]) : std::errc::invalid_argument;
+        if ((ec == std::errc()) && (comma == std::string_view::npos) && (count < 1)) {
+            ec = std::errc::invalid_argument;
+        }
+        /* The first year counts from 0 (this year), the others from 1 */
+        if ((ec == std::errc()) && (count > 0) && (field[count] < ((count == 1) ? 0 : 1))) {
+            ec = std::errc::result_out_of_range;
+        }
+        if (ec == std::errc::result_out_of_range) {
+            throw std::runtime_error("Out-of-range number" + location(lineNum, line, token) + \
+                                     " '" + std::string(line) + "'");
+        }
+        else if (ec != std::errc()) {
+            throw std::runtime_error("Invalid format" + location(lineNum, line, token) + \
+                                     " '" + std::string(line) + "': expected <amount>, <first year>" + \
+                                     "[, <years>[, <every>]]");
+        }
+        count++;
+        if (comma == std::string_view::npos) {
+            break;
+        }
+        value = value.substr(comma + 1);
+    }
+
+    /* Years past the simulated ones are dropped */
+    for (long int year = field[1], n = 0; (n < field[2]) && (year < MAX_YEARS); n++, year += field[3]) {
+        long int total = static_cast<long int>(user.eventExpense[year]) + field[0];
+        if ((total > INT32_MAX) || (total < INT32_MIN)) {
+            throw std::runtime_error("Out-of-range event total in year " + std::to_string(year) + \
+                                     " on line " + std::to_string(lineNum) + " '" + std::string(line) + "'");
+        }
+        user.eventExpense[year] = static_cast<int>(total);
+    }
 }
 
-/* Reads user data from INI file format. */
+/* Reads user data from INI file format. 
+ * The whole file is read into one (reused) buffer and tokenized in place,
+ * so no allocation happens per line.
+ */
 void loadUserFinancialProfile(UserData& user, const std::string filename) {
-    std::ifstream file;
-    file.open(filename);
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
     if (!file.is_open()) {
         std::cerr << "Error: Could not open INI file!" << std::endl;
         return;
@@ -63,144 +348,187 @@ void loadUserFinancialProfile(UserData& user, const std::string filename) {
 
     std::cout << "Loading user data from file " << filename << "...\n" << std::endl;
 
-    std::string line, section;
+    /* Reused across calls so that loading many profiles does not allocate */
+    thread_local std::string buffer;
+    buffer.resize(static_cast<size_t>(file.tellg()));
+    file.seekg(0);
+    file.read(buffer.data(), buffer.size());
+    file.close();
+
+    /* The profile is identified by its file name, e.g. data/demo_profile.ini
+     * is profile "demo" */
+    std::string_view id(filename);
+    id = id.substr(id.find_last_of('/') + 1);
+    if ((id.size() > USERDATA_FILE_ENDING.size()) && \
+        (id.substr(id.size() - USERDATA_FILE_ENDING.size()) == USERDATA_FILE_ENDING)) {
+        id.remove_suffix(USERDATA_FILE_ENDING.size());
+    }
+    user.profileId = id;
+
+    /* Without a [Covariance] section the default matrix is used */
+    for (int c = 0; c < MAX_ACCOUNTS; c++) {
+        std::fill(user.covariance[c], user.covariance[c] + MAX_ACCOUNTS, 0.0f);
+    }
+    std::fill(user.eventExpense, user.eventExpense + MAX_YEARS, 0);
 
+    /* Optional [General] keys are 0 when not given */
+    user.birthYear = 0;
+    user.sex = 0;
+    user.spendingRule = 0;
+    user.cashReserveYears = 0.0f;
+    user.cashReserveRefill = 0.0f;
+
+    enum class Section { NONE, ASSETS, GENERAL, COVARIANCE, EVENTS, OTHER };
+    Section section = Section::NONE;
     short index = 0;
+    short covarianceRow = 0;
+    size_t lineNum = 0;
 
-    /* Map for General section key-to-action mapping */
-    const std::unordered_map<std::string, std::function<void(const std::string&)>> generalHandlers = {
-        {"Cost-of-living",              [&](const std::string& v) { user.initialExpense = stoi(v); }},
-        {"Current-annual-takehome-income", [&](const std::string& v) { user.takehomeIncome = stoi(v); }},
-        {"Current-annual-roth-contribution", [&](const std::string& v) { user.contributionRoth = stoi(v); }},
-        {"Current-annual-ira-contribution",  [&](const std::string& v) { user.contributionIra = stoi(v); }},
-        {"Current-annual-r401k-contribution", [&](const std::string& v) { user.contributionR401k = stoi(v); }},
-        {"Pension-estimate",            [&](const std::string& v) { user.pensionEstimate = stoi(v); }},
-        {"Inflation",                   [&](const std::string& v) { user.initialInflation = stof(v); }},
-        {"Years-till-retirement",       [&](const std::string& v) { user.yearsTillRetirement = static_cast<unsigned short>(stoi(v)); }},
-        {"Years-till-withdrawal",       [&](const std::string& v) { user.yearsTillWithdrawal = static_cast<unsigned short>(stoi(v)); }},
-        {"Years-till-pension",          [&](const std::string& v) { user.yearsTillPension = static_cast<unsigned short>(stoi(v)); }}
-    };
-
-    while (getline(file, line)) {
-        line = line.substr(0, line.find(';')); // Ignore comments
-        if (line.empty()) continue;
-
-        if (line[0] == '[' && line.back() == ']') {
-            section = line.substr(1, line.length() - 2);
-        } else {
-            std::stringstream ss(line);
-            std::string key, value1, value2;
-            getline(ss, key, '=');
-            key = trim(key);
-
-            try {
-                if ((section == "Assets") && index < MAX_ACCOUNTS) {
-                    getline(ss, value1, ',');
-                    getline(ss, value2);
-                    user.name[index] = key;
-                    user.value[index] = stoi(value1);
-                    user.rate[index++] = stof(value2);
-
-                } else if (section == "General") {
-                    getline(ss, value1, ',');
-                    auto it = generalHandlers.find(key);
-                    if (it != generalHandlers.end()) {
-                        try {
-                            it->second(value1);
-                        } catch (const std::exception& e) {
-                            throw std::runtime_error("Error parsing value for '" + key + "': " + e.what());
-                        }
-                    }
-                    else {
-                        throw std::runtime_error("Unknown key in General section: " + key);
-                    }
-                }
-            } catch (const std::invalid_argument& e) {
-                throw std::runtime_error("Invalid format on line '" + line + "': " + e.what());
-            } catch (const std::out_of_range& e) {
-                throw std::runtime_error("Out-of-range number on line '" + line + "': " + e.what());
-            }
-            
+    std::string_view text(buffer);
+    while (!text.empty()) {
+        size_t eol = text.find('\n');
+        std::string_view line = text.substr(0, eol);
+        text = (eol == std::string_view::npos) ? std::string_view() : text.substr(eol + 1);
+        lineNum++;
+
+        /* Ignore comments */
+        std::string_view content = trim(line.substr(0, line.find(';')));
+        if (content.empty()) continue;
+
+        if ((content.front() == '[') && (content.back() == ']')) {
+            std::string_view name = content.substr(1, content.size() - 2);
+            section = (name == "Assets") ? Section::ASSETS : \
+                      (name == "General") ? Section::GENERAL : \
+                      (name == "Covariance") ? Section::COVARIANCE : \
+                      (name == "Events") ? Section::EVENTS : Section::OTHER;
+            continue;
+        }
+
+        size_t equal = content.find('=');
+        std::string_view key = trim(content.substr(0, equal));
+        std::string_view value = (equal == std::string_view::npos) ? \
+                                 content.substr(content.size()) : trim(content.substr(equal + 1));
+
+        if ((section == Section::ASSETS) && (index < MAX_ACCOUNTS)) {
+            parseAssetLine(user, index++, line, lineNum, key, value);
+        }
+        else if (section == Section::GENERAL) {
+            parseGeneralLine(user, line, lineNum, key, trim(value.substr(0, value.find(','))));
+        }
+        else if ((section == Section::COVARIANCE) && (covarianceRow < MAX_ACCOUNTS)) {
+            parseCovarianceLine(user, covarianceRow++, line, lineNum, value);
+        }
+        else if (section == Section::EVENTS) {
+            parseEventLine(user, line, lineNum, value);
         }
     }
-    file.close();
 }
 
 /* Check if any numeric field of UserData is out of bounds 
  * Returns true if all data is within bounds,
- * false otherwise. 
+ * false otherwise. Errors are printed only if verbose is set.
  * */
-bool userDataWithinBounds(const UserData& user) {
+bool userDataWithinBounds(const UserData& user, bool verbose) {
     /* Initialize a count for the number of out-of-bounds data identified */
     unsigned int outOfBounds = 0;
     for (int c = 0; c < MAX_ACCOUNTS; c++) {
         if (user.value[c] < 0) {
             outOfBounds++;
-            std::cerr << "ERROR: starting value for " << user.name[c] \
+            if (verbose) std::cerr << "ERROR: starting value for " << user.name[c] \
                       << " must be non-negative" \
                       << std::endl;
         }
         if ((user.rate[c] < 0) || (user.rate[c] > MAX_AVG_GROWTH)) {
             outOfBounds++;
-            std::cerr << "ERROR: growth rate for " << user.name[c] \
+            if (verbose) std::cerr << "ERROR: growth rate for " << user.name[c] \
                       << " must be within [0, " << MAX_AVG_GROWTH \
                       << "]" << std::endl;
         }
     }
     if (user.initialExpense < 0) {
         outOfBounds++;
-        std::cerr << "ERROR: current annual expense must be non-negative" \
+        if (verbose) std::cerr << "ERROR: current annual expense must be non-negative" \
                   << std::endl;
     }
     if (user.takehomeIncome < 0) {
         outOfBounds++;
-        std::cerr << "ERROR: current takehome income must be non-negative" \
+        if (verbose) std::cerr << "ERROR: current takehome income must be non-negative" \
                   << std::endl;
     }
     if ((user.contributionRoth < 0) || (user.contributionRoth > MAX_ROTH_CONTRIBUTION)) {
         outOfBounds++;
-        std::cerr << "ERROR: Roth contribution " \
+        if (verbose) std::cerr << "ERROR: Roth contribution " \
                     << " must be non-negative and less than " << MAX_ROTH_CONTRIBUTION \
                     << std::endl;
     }
     if ((user.contributionIra < 0) || (user.contributionIra > MAX_IRA_CONTRIBUTION)) {
         outOfBounds++;
-        std::cerr << "ERROR: IRA contribution " \
+        if (verbose) std::cerr << "ERROR: IRA contribution " \
                     << " must be non-negative and less than " << MAX_IRA_CONTRIBUTION \
                     << std::endl;
     }
     if ((user.contributionR401k < 0) || (user.contributionR401k > MAX_R401K_CONTRIBUTION)) {
         outOfBounds++;
-        std::cerr << "ERROR: IRA contribution " \
+        if (verbose) std::cerr << "ERROR: IRA contribution " \
                     << " must be non-negative and less than " << MAX_R401K_CONTRIBUTION \
                     << std::endl;
     }
     if (user.pensionEstimate < 0) {
         outOfBounds++;
-        std::cerr << "ERROR: pension estimate must be non-negative" \
+        if (verbose) std::cerr << "ERROR: pension estimate must be non-negative" \
                   << std::endl;
     }
     if ((user.initialInflation < 0) || (user.initialInflation > MAX_AVG_INFLATION)) {
         outOfBounds++;
-        std::cerr << "ERROR: inflation must be within [0, " << MAX_AVG_INFLATION \
+        if (verbose) std::cerr << "ERROR: inflation must be within [0, " << MAX_AVG_INFLATION \
                   << "]" << std::endl;
     }
     if ((user.yearsTillRetirement < 0) || (user.yearsTillRetirement > MAX_YEARS)) {
         outOfBounds++;
-        std::cerr << "ERROR: years till retirement must be within [0, " << MAX_YEARS \
+        if (verbose) std::cerr << "ERROR: years till retirement must be within [0, " << MAX_YEARS \
                   << "]" << std::endl;
     }
     if ((user.yearsTillWithdrawal < 0) || (user.yearsTillWithdrawal > MAX_YEARS)) {
         outOfBounds++;
-        std::cerr << "ERROR: years till withdrawal must be within [0, " << MAX_YEARS \
+        if (verbose) std::cerr << "ERROR: years till withdrawal must be within [0, " << MAX_YEARS \
                   << "]" << std::endl;
     }
     if ((user.yearsTillPension < 0) || (user.yearsTillPension > MAX_YEARS)) {
         outOfBounds++;
-        std::cerr << "ERROR: years till pension must be within [0, " << MAX_YEARS \
+        if (verbose) std::cerr << "ERROR: years till pension must be within [0, " << MAX_YEARS \
                   << "]" << std::endl;
     }
-    if (outOfBounds) {
+    if ((user.birthYear != 0) && ((user.birthYear > CURRENT_YEAR) || (user.birthYear < CURRENT_YEAR - RMD_LAST_AGE))) {
+        outOfBounds++;
+        if (verbose) std::cerr << "ERROR: birth year must be 0 (not given) or within [" \
+                  << CURRENT_YEAR - RMD_LAST_AGE << ", " << CURRENT_YEAR << "]" << std::endl;
+    }
+    if (user.sex >= LIFE_TABLE_SEXES) {
+        outOfBounds++;
+        if (verbose) std::cerr << "ERROR: sex must be 0 (not given), 1 (male) or 2 (female)" << std::endl;
+    }
+    if (user.spendingRule > static_cast<unsigned short>(SpendingRule::MAX)) {
+        outOfBounds++;
+        if (verbose) std::cerr << "ERROR: spending rule must be fixed, guardrails, percent-of-portfolio" \
+                  << " or floor-ceiling (0 to " << static_cast<unsigned short>(SpendingRule::MAX) << ")" << std::endl;
+    }
+    if (!((user.cashReserveYears >= 0) && (user.cashReserveYears <= MAX_CASH_RESERVE_YEARS))) {
+        outOfBounds++;
+        if (verbose) std::cerr << "ERROR: cash reserve years must be within [0, " << MAX_CASH_RESERVE_YEARS \
+                  << "]" << std::endl;
+    }
+    if (!((user.cashReserveRefill > -1) && (user.cashReserveRefill <= MAX_AVG_GROWTH))) {
+        outOfBounds++;
+        if (verbose) std::cerr << "ERROR: cash reserve refill return must be within (-1, " << MAX_AVG_GROWTH \
+                  << "]" << std::endl;
+    }
+    ReturnFactor factor;
+    if (hasCovariance(user) && !factorCovariance(user, factor)) {
+        outOfBounds++;
+        if (verbose) std::cerr << "ERROR: covariance matrix must be symmetric and positive semi-definite" \
+                  << std::endl;
+    }
+    if (outOfBounds && verbose) {
         std::cout << "Please correct these " << outOfBounds \
                   << " out-of-bounds number(s) in your user_profile.ini file." << std::endl;
     }
@@ -223,6 +551,19 @@ void displayUserInfo(const UserData& user) {
     std::cout << "Years till retirement: " << user.yearsTillRetirement << std::endl;
     std::cout << "Years till withdrawal: " << user.yearsTillWithdrawal << std::endl;
     std::cout << "Years till pension: " << user.yearsTillPension << std::endl;
+    if (user.birthYear != 0) {
+        std::cout << "Birth year: " << user.birthYear << std::endl;
+    }
+    if (user.sex != SEX_UNKNOWN) {
+        std::cout << "Sex: " << ((user.sex == SEX_MALE) ? "male" : "female") << std::endl;
+    }
+    if ((user.spendingRule != 0) && (user.spendingRule <= static_cast<unsigned short>(SpendingRule::MAX))) {
+        std::cout << "Spending rule: " << SPENDING_RULE_NAMES[user.spendingRule] << std::endl;
+    }
+    if (user.cashReserveYears > 0) {
+        std::cout << "Cash reserve: " << user.cashReserveYears << " years of net expense, refilled after returns of at least " \
+                  << user.cashReserveRefill << std::endl;
+    }
 
     std::cout << "\nUser's Asset Data:" << std::endl;
     for (int i = 0; i < MAX_ACCOUNTS; i++) {
@@ -230,5 +571,23 @@ void displayUserInfo(const UserData& user) {
                   << ", Initial Value: $" << user.value[i]
                   << ", Growth Rate: " << user.rate[i] << std::endl;
     }
+    if (hasCovariance(user)) {
+        std::cout << "\nUser's Return Covariance:" << std::endl;
+        for (int i = 0; i < MAX_ACCOUNTS; i++) {
+            std::cout << user.name[i] << ":";
+            for (int j = 0; j < MAX_ACCOUNTS; j++) {
+                std::cout << " " << user.covariance[i][j];
+            }
+            std::cout << std::endl;
+        }
+    }
+    if (std::any_of(user.eventExpense, user.eventExpense + MAX_YEARS, [](int e) { return e != 0; })) {
+        std::cout << "\nUser's Life Events (today's dollars, negative for an income):" << std::endl;
+        for (int i = 0; i < MAX_YEARS; i++) {
+            if (user.eventExpense[i] != 0) {
+                std::cout << "Year " << CURRENT_YEAR + i << ": $" << user.eventExpense[i] << std::endl;
+            }
+        }
+    }
     std::cout << "===========================================================" << std::endl;
 }
\ No newline at end of file
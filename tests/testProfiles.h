@@ -0,0 +1,51 @@
+/* ============================================================================
+ * testProfiles.h
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Profiles shared by the unit tests. Each test starts from one of them and
+ *  overrides only the fields it is about.
+ *
+ *  Created: 	October 2026
+ *  Maintainer: Yuping X
+ * ============================================================================
+ */
+#ifndef TEST_PROFILES_H_
+#define TEST_PROFILES_H_
+
+#include <string>
+#include "userDataLoading.h"
+
+/* A profile with the four accounts named and everything else 0 */
+inline UserData makeNamedUser(const std::string& id) {
+    UserData user{};
+    const char* names[MAX_ACCOUNTS] = {"Individual", "Roth", "Ira", "401k"};
+    user.profileId = id;
+    for (int c = 0; c < MAX_ACCOUNTS; c++) {
+        user.name[c] = names[c];
+    }
+    return user;
+}
+
+/* A saver ten years from retirement, with savings in every account, who
+ * spends expense a year */
+inline UserData makeTestUser(const std::string& id = "test", int expense = 70000) {
+    UserData user = makeNamedUser(id);
+    for (int c = 0; c < MAX_ACCOUNTS; c++) {
+        user.value[c] = 100000 * (c + 1);
+        user.rate[c] = 0.05f + 0.01f * c;
+    }
+    user.initialExpense = expense;
+    user.takehomeIncome = 60000;
+    user.contributionRoth = 5000;
+    user.contributionIra = 3000;
+    user.contributionR401k = 15000;
+    user.pensionEstimate = 20000;
+    user.initialInflation = 0.03f;
+    user.yearsTillRetirement = 10;
+    user.yearsTillWithdrawal = 12;
+    user.yearsTillPension = 15;
+    return user;
+}
+
+#endif /* TEST_PROFILES_H_ */
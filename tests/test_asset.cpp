@@ -15,6 +15,8 @@
 #include <climits>
 #include "asset.h"
 #include "modelRecession.h"
+#include "profileSchedule.h"
+#include "testProfiles.h"
 
 TEST(AssetTest, StandardConstructor) {
     // The standard constructor sets all numerical data members to zeros
@@ -488,3 +490,126 @@ TEST(AssetTest, SimpleIncomeSimplePensionNoInflationNoGrowthGapModel) {
 
     EXPECT_EQ(myAsset.getFundLongevity(), L_EXPECTED);
 }
+
+/* A retiree spending from the individual account only, which grows with
+ * the stock market, keeping two years of net expense in cash */
+static UserData makeReserveUser() {
+    UserData user = makeNamedUser("reserve");
+    for (int c = 0; c < MAX_ACCOUNTS; c++) {
+        user.rate[c] = STOCK_GROWTH_AVG;
+    }
+    user.value[INDIVIDUAL_INDEX] = 1000000;
+    user.initialExpense = 50000;
+    user.yearsTillWithdrawal = MAX_YEARS;
+    user.yearsTillPension = MAX_YEARS;
+    user.cashReserveYears = 2.0f;
+    user.cashReserveRefill = 0.1f;
+    return user;
+}
+
+TEST(AssetTest, CashReserveDrawnAfterLossRefilledAfterGain) {
+    UserData user = makeReserveUser();
+    ASSERT_TRUE(userDataWithinBounds(user, false));
+    Asset myAsset;
+    ProfileSchedule schedule;
+    myAsset.initializeFromUserData(user);
+    schedule.initializeFromUserData(user);
+    myAsset.populateGrowthCurves(ModelOption::PREDEFINED_YEAR0_LOSS);
+    myAsset.calculateN(schedule);
+
+    /* Year 0 fills the reserve and spends from the rest of the account */
+    const long int T = 2 * user.initialExpense;
+    EXPECT_EQ(myAsset.value_[INDIVIDUAL_INDEX][0], user.value[INDIVIDUAL_INDEX] - T);
+    EXPECT_NEAR(myAsset.distribution_[INDIVIDUAL_INDEX][0], user.initialExpense, 1);
+
+    /* After the loss of year 0, year 1 is spent from the reserve */
+    ASSERT_LT(RECESSION_YEAR0_LOSS[0], 0.0f);
+    EXPECT_EQ(myAsset.distribution_[INDIVIDUAL_INDEX][1], 0);
+    long int grown = static_cast<long int>(myAsset.value_[INDIVIDUAL_INDEX][1] * (1 + RECESSION_YEAR0_LOSS[1]));
+
+    /* After the gain of year 1, year 2 refills what was drawn */
+    ASSERT_GE(RECESSION_YEAR0_LOSS[1], user.cashReserveRefill);
+    EXPECT_NEAR(myAsset.value_[INDIVIDUAL_INDEX][2], grown - user.initialExpense, 1);
+    EXPECT_NEAR(myAsset.distribution_[INDIVIDUAL_INDEX][2], user.initialExpense, 1);
+
+    /* A gain below the refill threshold leaves the reserve as it is */
+    user.cashReserveRefill = 0.15f;
+    schedule.initializeFromUserData(user);
+    myAsset.calculateN(schedule);
+    EXPECT_NEAR(myAsset.value_[INDIVIDUAL_INDEX][2], grown, 1);
+
+    /* Out of bounds targets are rejected */
+    user.cashReserveYears = -1.0f;
+    EXPECT_FALSE(userDataWithinBounds(user, false));
+}
+
+TEST(AssetTest, CashReserveCoversShortfallWithoutGrowth) {
+    /* Without growth or inflation, cash lasts as long as the account, and
+     * the reserve is spent once the account runs short */
+    UserData user = makeReserveUser();
+    for (int c = 0; c < MAX_ACCOUNTS; c++) {
+        user.rate[c] = 0.0f;
+    }
+    user.value[INDIVIDUAL_INDEX] = 1020000;
+    Asset withReserve, without;
+    ProfileSchedule schedule;
+    withReserve.initializeFromUserData(user);
+    schedule.initializeFromUserData(user);
+    withReserve.populateGrowthCurves(ModelOption::CONSTANT);
+    withReserve.calculateN(schedule);
+
+    user.cashReserveYears = 0.0f;
+    ProfileSchedule plain;
+    without.initializeFromUserData(user);
+    plain.initializeFromUserData(user);
+    without.populateGrowthCurves(ModelOption::CONSTANT);
+    without.calculateN(plain);
+
+    EXPECT_EQ(withReserve.getFundLongevity(), 20);
+    EXPECT_EQ(withReserve.getFundLongevity(), without.getFundLongevity());
+    EXPECT_LT(withReserve.distribution_[INDIVIDUAL_INDEX][19], user.initialExpense);
+}
+
+/* Withdrawals of the first two years of a retiree spending 50000 a year from
+ * 1000000, whose individual account returns first_return in year 0 */
+static std::array<long int, 2> firstWithdrawals(const char* rule, float first_return) {
+    UserData user = makeReserveUser();
+    user.cashReserveYears = 0.0f;
+    user.cashReserveRefill = 0.0f;
+    EXPECT_EQ(parseGeneralValue(user, GeneralKey::SPENDING_RULE, rule), std::errc());
+
+    AccountCurves growth = {};
+    growth[INDIVIDUAL_INDEX][0] = first_return;
+    Asset myAsset;
+    ProfileSchedule schedule;
+    myAsset.initializeFromUserData(user);
+    schedule.initializeFromUserData(user);
+    myAsset.populateGrowthCurves(growth);
+    myAsset.calculateN(schedule);
+    return {myAsset.distribution_[INDIVIDUAL_INDEX][0], myAsset.distribution_[INDIVIDUAL_INDEX][1]};
+}
+
+TEST(AssetTest, SpendingRulesFollowThePortfolio) {
+    /* The first year sets the initial withdrawal rate of 5%; after a loss
+     * to 665000 the fixed rule keeps spending as planned, the guardrails
+     * cut it by a step, the percent-of-portfolio rule spends 5% of what is
+     * left, and the floor-ceiling rule stops at the floor */
+    EXPECT_NEAR(firstWithdrawals("fixed", -0.3f)[0], 50000, 1);
+    EXPECT_NEAR(firstWithdrawals("fixed", -0.3f)[1], 50000, 1);
+    EXPECT_NEAR(firstWithdrawals("guardrails", -0.3f)[0], 50000, 1);
+    EXPECT_NEAR(firstWithdrawals("guardrails", -0.3f)[1], 50000 * (1 - GUARDRAIL_STEP), 2);
+    EXPECT_NEAR(firstWithdrawals("percent-of-portfolio", -0.3f)[1], 0.05 * 665000, 2);
+    EXPECT_NEAR(firstWithdrawals("floor-ceiling", -0.3f)[1], SPENDING_FLOOR * 50000, 2);
+
+    /* After a gain to 1425000, the other way round */
+    EXPECT_NEAR(firstWithdrawals("guardrails", 0.5f)[1], 50000 * (1 + GUARDRAIL_STEP), 2);
+    EXPECT_NEAR(firstWithdrawals("percent-of-portfolio", 0.5f)[1], 0.05 * 1425000, 2);
+    EXPECT_NEAR(firstWithdrawals("2", 0.5f)[1], 0.05 * 1425000, 2);
+    EXPECT_NEAR(firstWithdrawals("floor-ceiling", 0.5f)[1], SPENDING_CEILING * 50000, 2);
+
+    /* Unknown rules are rejected */
+    UserData user = makeReserveUser();
+    EXPECT_NE(parseGeneralValue(user, GeneralKey::SPENDING_RULE, "never"), std::errc());
+    user.spendingRule = static_cast<unsigned short>(SpendingRule::MAX) + 1;
+    EXPECT_FALSE(userDataWithinBounds(user, false));
+}
@@ -73,6 +73,7 @@ TEST(UserDataLoadingTest, UnknownKeyInGeneralSection) {
         FAIL() << "Expected exception not thrown";
     } catch (const std::runtime_error& e) {
         EXPECT_TRUE(std::string(e.what()).find("Unknown key in General section") != std::string::npos);
+        EXPECT_TRUE(std::string(e.what()).find("on line 2, column 1") != std::string::npos);
     }
 
     /* Simple clean up */
@@ -101,6 +102,35 @@ TEST(UserDataLoadingTest, CannotParseKeyValueInGeneralSection) {
     std::remove(TESTFILE.c_str());
 }
 
+TEST(UserDataLoadingTest, LeadingPlusSignIsAccepted) {
+    // Create a temporary .ini file with signed values, as std::stoi and
+    // std::stof always accepted
+    const std::string TESTFILE = "signed_profile.ini";
+    std::ofstream fout(TESTFILE);
+    ASSERT_TRUE(fout.is_open());
+
+    fout << "[Assets]\n";
+    fout << "Individual=+1000,+0.1\n";
+    fout << "[General]\n";
+    fout << "Cost-of-living = +70000\n";
+    fout << "Inflation = +0.02\n";
+    fout.close();
+
+    UserData user{};
+    loadUserFinancialProfile(user, TESTFILE);
+    EXPECT_EQ(user.value[0], 1000);
+    EXPECT_FLOAT_EQ(user.rate[0], 0.1f);
+    EXPECT_EQ(user.initialExpense, 70000);
+    EXPECT_FLOAT_EQ(user.initialInflation, 0.02f);
+
+    // ... but only one sign
+    std::ofstream(TESTFILE) << "[General]\nCost-of-living = +-70000\n";
+    EXPECT_THROW(loadUserFinancialProfile(user, TESTFILE), std::runtime_error);
+
+    /* Simple clean up */
+    std::remove(TESTFILE.c_str());
+}
+
 TEST(UserDataLoadingTest, BoundsCheckSuccess) {
     // Create a temporary .ini file with all valid data
     const std::string TESTFILE = "valid_profile.ini";
@@ -221,4 +251,84 @@ TEST(UserDataLoadingTest, BoundsCheckLargeValue) {
 
     /* Simple clean up */
     std::remove(TESTFILE.c_str());
-}
\ No newline at end of file
+}
+
+TEST(UserDataLoadingTest, ErrorReportsLineAndColumn) {
+    // Create a temporary .ini file with a bad value on the fourth line
+    const std::string TESTFILE = "invalid_profile.ini";
+    std::ofstream fout(TESTFILE);
+    ASSERT_TRUE(fout.is_open());
+
+    fout << "; comment line\n";
+    fout << "[General]\n";
+    fout << "Cost-of-living = 1000\n";
+    fout << "Inflation = 0.0x2\n";  // Value cannot be parsed as a number
+    fout.close();
+
+    UserData user;
+    try {
+        loadUserFinancialProfile(user, TESTFILE);
+        FAIL() << "Expected exception not thrown";
+    } catch (const std::runtime_error& e) {
+        EXPECT_TRUE(std::string(e.what()).find("Error parsing value for 'Inflation'") != std::string::npos);
+        EXPECT_TRUE(std::string(e.what()).find("line 4, column 13") != std::string::npos);
+    }
+
+    /* Simple clean up */
+    std::remove(TESTFILE.c_str());
+}
+
+TEST(UserDataLoadingTest, EventsCompileIntoYearlyExpense) {
+    const std::string TESTFILE = "events_profile.ini";
+    std::ofstream fout(TESTFILE);
+    ASSERT_TRUE(fout.is_open());
+
+    fout << "[General]\n";
+    fout << "Cost-of-living = 1000\n";
+    fout << "[Events]\n";
+    fout << "House = 50000, 3\n";                // Year 3 only
+    fout << "College = 20000, 2, 4\n";           // Years 2 to 5
+    fout << "Car = 30000, 0, 100, 10\n";         // Every 10 years, past the last one dropped
+    fout << "Inheritance = -100000, 5\n";        // An income
+    fout.close();
+
+    UserData user;
+    loadUserFinancialProfile(user, TESTFILE);
+    EXPECT_EQ(user.eventExpense[0], 30000);
+    EXPECT_EQ(user.eventExpense[1], 0);
+    EXPECT_EQ(user.eventExpense[2], 20000);
+    EXPECT_EQ(user.eventExpense[3], 70000);
+    EXPECT_EQ(user.eventExpense[5], 20000 - 100000);
+    EXPECT_EQ(user.eventExpense[6], 0);
+    EXPECT_EQ(user.eventExpense[40], 30000);
+
+    /* A bad repeat interval is reported where it is */
+    fout.open(TESTFILE);
+    fout << "[Events]\n";
+    fout << "Car = 30000, 0, 5, 0\n";
+    fout.close();
+    try {
+        loadUserFinancialProfile(user, TESTFILE);
+        FAIL() << "Expected exception not thrown";
+    } catch (const std::runtime_error& e) {
+        EXPECT_TRUE(std::string(e.what()).find("Out-of-range number on line 2, column 20") != std::string::npos);
+    }
+
+    /* Reloading starts from no events */
+    fout.open(TESTFILE);
+    fout << "[Events]\n";
+    fout << "Car = 30000\n";
+    fout.close();
+    EXPECT_THROW(loadUserFinancialProfile(user, TESTFILE), std::runtime_error);
+    fout.open(TESTFILE);
+    fout << "[General]\n";
+    fout << "Cost-of-living = 1000\n";
+    fout.close();
+    loadUserFinancialProfile(user, TESTFILE);
+    for (int i = 0; i < MAX_YEARS; i++) {
+        EXPECT_EQ(user.eventExpense[i], 0);
+    }
+
+    /* Simple clean up */
+    std::remove(TESTFILE.c_str());
+}
@@ -0,0 +1,123 @@
+/* ============================================================================
+ * test_householdBook.cpp
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Minimum unit tests for bulk household book loading.
+ *
+ *  Created: 	October 2026
+ *  Maintainer: Yuping X
+ * ============================================================================
+ */
+#include <gtest/gtest.h>
+#include <fstream>
+#include <string>
+#include "householdBook.h"
+
+/* Header and one valid row, separated by the given delimiter */
+static std::string bookHeader(char d) {
+    std::string h = "Household";
+    for (const std::string& name : BOOK_ACCOUNT_NAMES) {
+        h += d + name + d + name + BOOK_RATE_SUFFIX;
+    }
+    h += std::string(1, d) + "Cost-of-living" + d + "Current-annual-takehome-income" + d + \
+         "Current-annual-roth-contribution" + d + "Current-annual-ira-contribution" + d + \
+         "Current-annual-r401k-contribution" + d + "Pension-estimate" + d + "Inflation" + d + \
+         "Years-till-retirement" + d + "Years-till-withdrawal" + d + "Years-till-pension";
+    return h;
+}
+
+static std::string bookRow(char d, const std::string& id, int expense) {
+    std::string r = id;
+    for (int c = 0; c < MAX_ACCOUNTS; c++) {
+        r += d + std::to_string(1000 * (c + 1)) + d + "0.05";
+    }
+    r += d + std::to_string(expense) + d + "50000" + d + "1000" + d + "0" + d + \
+         "2000" + d + "10000" + d + "0.03" + d + "20" + d + "20" + d + "25";
+    return r;
+}
+
+TEST(HouseholdBookTest, LoadCsvBook) {
+    const std::string TESTFILE = "test_book.csv";
+    std::ofstream fout(TESTFILE);
+    ASSERT_TRUE(fout.is_open());
+    fout << bookHeader(',') << "\n";
+    fout << bookRow(',', "first", 40000) << "\n";
+    fout << "\n";
+    fout << bookRow(',', "second", 45000) << "\r\n";
+    fout.close();
+
+    std::vector<UserData> households = loadHouseholdBook(TESTFILE);
+    ASSERT_EQ(households.size(), 2);
+    EXPECT_EQ(households[0].profileId, "first");
+    EXPECT_EQ(households[1].profileId, "second");
+    EXPECT_EQ(households[1].initialExpense, 45000);
+    EXPECT_EQ(households[1].value[R401K_INDEX], 4000);
+    EXPECT_FLOAT_EQ(households[1].rate[ROTH_INDEX], 0.05f);
+    EXPECT_EQ(households[1].yearsTillPension, 25);
+    EXPECT_EQ(households[1].name[INDIVIDUAL_INDEX], BOOK_ACCOUNT_NAMES[INDIVIDUAL_INDEX]);
+
+    std::remove(TESTFILE.c_str());
+}
+
+TEST(HouseholdBookTest, LargeTsvBookKeepsOrderAndSkipsInvalid) {
+    /* Large enough to be split across several threads */
+    const std::string TESTFILE = "test_book.tsv";
+    const int ROWS = 5000;
+    std::ofstream fout(TESTFILE);
+    ASSERT_TRUE(fout.is_open());
+    fout << bookHeader('\t') << "\n";
+    for (int r = 0; r < ROWS; r++) {
+        /* Every 100th household has a negative (out-of-bounds) expense */
+        fout << bookRow('\t', "h" + std::to_string(r), (r % 100 == 0) ? -1 : 40000 + r) << "\n";
+    }
+    fout.close();
+
+    std::vector<UserData> households = loadHouseholdBook(TESTFILE);
+    ASSERT_EQ(households.size(), ROWS - ROWS / 100);
+    size_t k = 0;
+    for (int r = 0; r < ROWS; r++) {
+        if (r % 100 == 0) continue;
+        EXPECT_EQ(households[k].profileId, "h" + std::to_string(r));
+        EXPECT_EQ(households[k].initialExpense, 40000 + r);
+        k++;
+    }
+
+    std::remove(TESTFILE.c_str());
+}
+
+TEST(HouseholdBookTest, MalformedRow) {
+    const std::string TESTFILE = "test_book.csv";
+    std::ofstream fout(TESTFILE);
+    ASSERT_TRUE(fout.is_open());
+    fout << bookHeader(',') << "\n";
+    fout << bookRow(',', "good", 40000) << "\n";
+    fout << "bad,1,2,3\n";
+    fout.close();
+
+    try {
+        loadHouseholdBook(TESTFILE);
+        FAIL() << "Expected exception not thrown";
+    } catch (const std::runtime_error& e) {
+        EXPECT_TRUE(std::string(e.what()).find("Invalid format on line 3") != std::string::npos);
+    }
+
+    std::remove(TESTFILE.c_str());
+}
+
+TEST(HouseholdBookTest, UnknownColumn) {
+    const std::string TESTFILE = "test_book.csv";
+    std::ofstream fout(TESTFILE);
+    ASSERT_TRUE(fout.is_open());
+    fout << bookHeader(',') << ",Favorite-color\n";
+    fout.close();
+
+    try {
+        loadHouseholdBook(TESTFILE);
+        FAIL() << "Expected exception not thrown";
+    } catch (const std::runtime_error& e) {
+        EXPECT_TRUE(std::string(e.what()).find("Unknown column") != std::string::npos);
+    }
+
+    std::remove(TESTFILE.c_str());
+}
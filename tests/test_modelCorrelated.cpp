@@ -0,0 +1,155 @@
+/* ============================================================================
+ * test_modelCorrelated.cpp
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Minimum unit tests for the correlated per-account growth model.
+ *
+ *  Created: 	October 2026
+ *  Maintainer: Yuping X
+ * ============================================================================
+ */
+#include <gtest/gtest.h>
+#include <fstream>
+#include <vector>
+#include <cstdio>
+#include "modelCorrelated.h"
+#include "modelRecession.h"
+#include "scenarioRng.h"
+
+/* A profile whose accounts have volatilities 0.1 to 0.4, correlated by 0.5 */
+static UserData makeCorrelatedUser() {
+    UserData user{};
+    for (int i = 0; i < MAX_ACCOUNTS; i++) {
+        user.rate[i] = 0.02f * (i + 1);
+        for (int j = 0; j < MAX_ACCOUNTS; j++) {
+            float correlation = (i == j) ? 1.0f : 0.5f;
+            user.covariance[i][j] = correlation * 0.1f * (i + 1) * 0.1f * (j + 1);
+        }
+    }
+    return user;
+}
+
+TEST(CorrelatedModelTest, FactorReproducesTheCovariance) {
+    UserData user = makeCorrelatedUser();
+    ReturnFactor factor;
+    ASSERT_TRUE(factorCovariance(user, factor));
+
+    for (int i = 0; i < MAX_ACCOUNTS; i++) {
+        EXPECT_FLOAT_EQ(factor.mean[i], user.rate[i]);
+        for (int j = 0; j < MAX_ACCOUNTS; j++) {
+            float product = 0;
+            for (int k = 0; k < MAX_ACCOUNTS; k++) {
+                product += factor.lower[i][k] * factor.lower[j][k];
+            }
+            EXPECT_NEAR(product, user.covariance[i][j], 1e-6);
+            if (j > i) {
+                EXPECT_EQ(factor.lower[i][j], 0.0f);
+            }
+        }
+    }
+}
+
+TEST(CorrelatedModelTest, DefaultCovarianceFollowsTheStockRatio) {
+    UserData user{};
+    user.rate[0] = STOCK_GROWTH_AVG / 2;
+    user.rate[1] = STOCK_GROWTH_AVG;
+    ASSERT_FALSE(hasCovariance(user));
+
+    ReturnFactor factor;
+    ASSERT_TRUE(factorCovariance(user, factor));
+    EXPECT_NEAR(factor.lower[0][0], STOCK_VOLATILITY / 2, 1e-6);
+    EXPECT_NEAR(factor.lower[1][0] * factor.lower[0][0],
+                ACCOUNT_CORRELATION_DEFAULT * STOCK_VOLATILITY * STOCK_VOLATILITY / 2, 1e-6);
+
+    /* Accounts with no return have no volatility either */
+    EXPECT_EQ(factor.lower[2][2], 0.0f);
+    EXPECT_EQ(factor.lower[3][0], 0.0f);
+}
+
+TEST(CorrelatedModelTest, RejectsInvalidMatrices) {
+    ReturnFactor factor;
+
+    UserData asymmetric = makeCorrelatedUser();
+    asymmetric.covariance[0][1] += 0.01f;
+    EXPECT_FALSE(factorCovariance(asymmetric, factor));
+
+    /* Correlations of 0.5 and -0.9 cannot hold together with +0.9 */
+    UserData indefinite{};
+    indefinite.covariance[0][0] = indefinite.covariance[1][1] = indefinite.covariance[2][2] = 1.0f;
+    indefinite.covariance[0][1] = indefinite.covariance[1][0] = 0.9f;
+    indefinite.covariance[0][2] = indefinite.covariance[2][0] = 0.9f;
+    indefinite.covariance[1][2] = indefinite.covariance[2][1] = -0.9f;
+    EXPECT_FALSE(factorCovariance(indefinite, factor));
+
+    /* A zero-variance account is fine as long as nothing covaries with it */
+    UserData cash = makeCorrelatedUser();
+    for (int j = 0; j < MAX_ACCOUNTS; j++) {
+        cash.covariance[0][j] = cash.covariance[j][0] = 0.0f;
+    }
+    EXPECT_TRUE(factorCovariance(cash, factor));
+    cash.covariance[0][1] = cash.covariance[1][0] = 0.01f;
+    EXPECT_FALSE(factorCovariance(cash, factor));
+}
+
+TEST(CorrelatedModelTest, ReturnsHaveTheProfileMeanAndCovariance) {
+    UserData user = makeCorrelatedUser();
+    ReturnFactor factor;
+    ASSERT_TRUE(factorCovariance(user, factor));
+
+    const size_t PATHS = 4000;
+    std::vector<AccountDraws> draws(PATHS);
+    std::vector<AccountCurves> growth(PATHS);
+    for (size_t p = 0; p < PATHS; p++) {
+        ScenarioRng generator(11, p);
+        generateAccountDraws(draws[p], generator);
+    }
+    correlateReturns(factor, draws.data(), PATHS, growth.data());
+
+    /* Pool all years of all paths */
+    const double samples = double(PATHS) * MAX_YEARS;
+    for (int i = 0; i < MAX_ACCOUNTS; i++) {
+        for (int j = 0; j <= i; j++) {
+            double sumI = 0, sumJ = 0, sumIJ = 0;
+            for (size_t p = 0; p < PATHS; p++) {
+                for (int n = 0; n < MAX_YEARS; n++) {
+                    sumI += growth[p][i][n];
+                    sumJ += growth[p][j][n];
+                    sumIJ += double(growth[p][i][n]) * growth[p][j][n];
+                }
+            }
+            double covariance = sumIJ / samples - (sumI / samples) * (sumJ / samples);
+            EXPECT_NEAR(sumI / samples, user.rate[i], 0.005);
+            EXPECT_NEAR(covariance, user.covariance[i][j], 0.02 * user.covariance[i][i]);
+        }
+    }
+}
+
+TEST(CorrelatedModelTest, LoadsAndChecksTheCovarianceSection) {
+    const std::string TESTFILE = "covariance_profile.ini";
+    {
+        std::ofstream fout(TESTFILE);
+        fout << "[Covariance]\n";
+        fout << "A = 0.04, 0.01, 0, 0\n";
+        fout << "B = 0.01, 0.09, 0, 0\n";
+        fout << "C = 0, 0, 0, 0\n";
+        fout << "D = 0, 0, 0, 0.01\n";
+    }
+    UserData user{};
+    loadUserFinancialProfile(user, TESTFILE);
+    EXPECT_TRUE(hasCovariance(user));
+    EXPECT_FLOAT_EQ(user.covariance[1][1], 0.09f);
+    EXPECT_FLOAT_EQ(user.covariance[0][1], 0.01f);
+    EXPECT_FLOAT_EQ(user.covariance[3][3], 0.01f);
+
+    user.covariance[1][0] = 0.02f;
+    EXPECT_FALSE(userDataWithinBounds(user, false));
+
+    {
+        std::ofstream fout(TESTFILE);
+        fout << "[Covariance]\n";
+        fout << "A = 0.04, 0.01, 0\n";
+    }
+    EXPECT_THROW(loadUserFinancialProfile(user, TESTFILE), std::runtime_error);
+    std::remove(TESTFILE.c_str());
+}
@@ -0,0 +1,70 @@
+/* ============================================================================
+ * test_modelHistorical.cpp
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Minimum unit tests for the historical block-bootstrap growth model.
+ *
+ *  Created: 	October 2026
+ *  Maintainer: Yuping X
+ * ============================================================================
+ */
+#include <gtest/gtest.h>
+#include <fstream>
+#include <cstdio>
+#include "modelHistorical.h"
+#include "scenarioRng.h"
+
+/* Writes a returns table of the given years, where year y returns y / 1000 */
+static void writeTestTable(const std::string& filename, int years) {
+    std::ofstream file(filename);
+    file << "# test table\n";
+    file << "Year,Return\n";
+    for (int y = 0; y < years; y++) {
+        file << (1900 + y) << "," << (y / 1000.0) << "\n";
+    }
+}
+
+TEST(HistoricalModelTest, CurvesAreWrappedBlocksOfTheTable) {
+    const std::string TESTFILE = "test_returns.csv";
+    const int YEARS = 12;
+    writeTestTable(TESTFILE, YEARS);
+    HistoricalReturns table(TESTFILE);
+    std::remove(TESTFILE.c_str());
+    EXPECT_EQ(table.years(), static_cast<uint32_t>(YEARS));
+
+    for (uint64_t iter = 0; iter < 200; iter++) {
+        ScenarioRng generator(3, iter);
+        std::array<float, MAX_YEARS> growth;
+        generateHistoricalBootstrap(growth, generator, table);
+
+        /* Within a block, years follow each other, wrapping to the first */
+        for (unsigned int n = 0; n < MAX_YEARS; n++) {
+            int year = static_cast<int>(growth[n] * 1000 + 0.5f);
+            ASSERT_GE(year, 0);
+            ASSERT_LT(year, YEARS);
+            if (n % HISTORICAL_BLOCK_YEARS != 0) {
+                int previous = static_cast<int>(growth[n - 1] * 1000 + 0.5f);
+                EXPECT_EQ(year, (previous + 1) % YEARS);
+            }
+        }
+
+        /* Same seed and iteration, same curve */
+        ScenarioRng again(3, iter);
+        std::array<float, MAX_YEARS> repeat;
+        generateHistoricalBootstrap(repeat, again, table);
+        EXPECT_EQ(growth, repeat);
+    }
+}
+
+TEST(HistoricalModelTest, RejectsMalformedTables) {
+    const std::string TESTFILE = "test_bad_returns.csv";
+    writeTestTable(TESTFILE, HISTORICAL_BLOCK_YEARS - 1);
+    EXPECT_THROW(HistoricalReturns table(TESTFILE), std::runtime_error);
+
+    std::ofstream(TESTFILE) << "Year,Return\n2000,abc\n";
+    EXPECT_THROW(HistoricalReturns table(TESTFILE), std::runtime_error);
+    std::remove(TESTFILE.c_str());
+
+    EXPECT_THROW(HistoricalReturns table("does_not_exist.csv"), std::runtime_error);
+}
@@ -0,0 +1,158 @@
+/* ============================================================================
+ * test_modelInflation.cpp
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Minimum unit tests for the stochastic inflation model.
+ *
+ *  Created: 	October 2026
+ *  Maintainer: Yuping X
+ * ============================================================================
+ */
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+#include "modelInflation.h"
+#include "modelRecession.h"
+#include "modelCorrelated.h"
+#include "profileSchedule.h"
+#include "resultCache.h"
+#include "scenarioBank.h"
+#include "studyRun.h"
+#include "threadPool.h"
+#include "testProfiles.h"
+
+TEST(InflationModelTest, DeviationsFollowTheAutoregression) {
+    const size_t PATHS = 20000;
+    const int LATE = MAX_YEARS - 1;
+    double sum = 0, sumSquares = 0, sumLagged = 0;
+    for (size_t p = 0; p < PATHS; p++) {
+        ScenarioRng generator(3, p);
+        InflationPath path;
+        generateInflationPath(path, generator, nullptr);
+
+        /* The growth is the running product of the deviations */
+        float growth = 1.0f;
+        for (int n = 0; n < MAX_YEARS; n++) {
+            ASSERT_NEAR(path.growth[n], growth, 1e-4f * growth);
+            growth *= 1 + path.deviation[n];
+        }
+        sum += path.deviation[LATE];
+        sumSquares += double(path.deviation[LATE]) * path.deviation[LATE];
+        sumLagged += double(path.deviation[LATE]) * path.deviation[LATE - 1];
+    }
+
+    /* Late in the path the deviation is stationary */
+    double variance = INFLATION_VOLATILITY * INFLATION_VOLATILITY / \
+                      (1 - INFLATION_PERSISTENCE * INFLATION_PERSISTENCE);
+    EXPECT_NEAR(sum / PATHS, 0.0, 0.001);
+    EXPECT_NEAR(sumSquares / PATHS, variance, 0.05 * variance);
+    EXPECT_NEAR(sumLagged / sumSquares, INFLATION_PERSISTENCE, 0.03);
+}
+
+TEST(InflationModelTest, ShocksMoveAgainstTheMarket) {
+    const size_t PATHS = 4000;
+    ScenarioBank bank(5, PATHS, nullptr, ModelOption::RECESSION_RANDOMIZED, InflationOption::STOCHASTIC);
+    ScenarioBank growthOnly(5, PATHS, nullptr, ModelOption::RECESSION_RANDOMIZED);
+
+    double sumShock = 0, sumMarket = 0, sumProduct = 0, sumShockSquares = 0, sumMarketSquares = 0;
+    for (size_t p = 0; p < PATHS; p++) {
+        /* Inflation is drawn after the growth, which it leaves unchanged */
+        ASSERT_EQ(bank[p], growthOnly[p]);
+
+        const InflationPath& path = bank.inflationPath(p);
+        for (int n = 1; n < MAX_YEARS; n++) {
+            double shock = path.deviation[n] - INFLATION_PERSISTENCE * path.deviation[n - 1];
+            double market = bank[p][n];
+            sumShock += shock;
+            sumMarket += market;
+            sumProduct += shock * market;
+            sumShockSquares += shock * shock;
+            sumMarketSquares += market * market;
+        }
+    }
+    double samples = double(PATHS) * (MAX_YEARS - 1);
+    double covariance = sumProduct / samples - (sumShock / samples) * (sumMarket / samples);
+    double shockVariance = sumShockSquares / samples - std::pow(sumShock / samples, 2);
+    double marketVariance = sumMarketSquares / samples - std::pow(sumMarket / samples, 2);
+    EXPECT_LT(covariance / std::sqrt(shockVariance * marketVariance), -0.1);
+}
+
+TEST(InflationModelTest, ScheduleFollowsThePathInflation) {
+    UserData user = makeTestUser("inflation");
+    ProfileSchedule built;
+    built.initializeFromUserData(user);
+
+    /* No deviation gives back the schedule as built, up to the truncation
+     * of the yearly amounts, which the built schedule compounds */
+    InflationPath flat;
+    flat.deviation.fill(0.0f);
+    flat.growth.fill(1.0f);
+    ProfileSchedule schedule = built;
+    schedule.inflate(flat);
+    for (int i = 0; i < MAX_YEARS; i++) {
+        EXPECT_NEAR(schedule.inflation_[i], built.inflation_[i], 1e-6);
+        EXPECT_NEAR(schedule.expense_[i], built.expense_[i], 2 + 5e-4 * built.expense_[i]);
+        EXPECT_NEAR(schedule.netExpense_[i], built.netExpense_[i], 4 + 5e-4 * built.expense_[i]);
+        for (int c = 0; c < MAX_ACCOUNTS; c++) {
+            EXPECT_NEAR(schedule.contribution_[c][i], built.contribution_[c][i],
+                        4 + 5e-4 * built.expense_[i]);
+        }
+    }
+    EXPECT_EQ(schedule.accumulationFastPath_, built.accumulationFastPath_);
+
+    /* One extra point of inflation a year compounds into every amount */
+    InflationPath higher;
+    float growth = 1.0f;
+    for (int n = 0; n < MAX_YEARS; n++) {
+        higher.deviation[n] = 0.01f;
+        higher.growth[n] = growth;
+        growth *= 1.01f;
+    }
+    schedule.inflate(higher);
+    EXPECT_NEAR(schedule.inflation_[0], 1.03f * 1.01f - 1, 1e-6);
+    EXPECT_EQ(schedule.expense_[0], built.expense_[0]);
+    EXPECT_NEAR(schedule.expense_[30], built.expense_[30] * higher.growth[30], 0.001 * schedule.expense_[30]);
+    EXPECT_NEAR(schedule.contribution_[R401K_INDEX][9], built.contribution_[R401K_INDEX][9] * higher.growth[9],
+                0.001 * schedule.contribution_[R401K_INDEX][9]);
+    EXPECT_EQ(schedule.contribution_[R401K_INDEX][10], 0);
+    EXPECT_EQ(schedule.income_[10], 0);
+
+    /* Amounts beyond 32 bits take the 64-bit truncation */
+    user.initialExpense = 1500000000;
+    built.initializeFromUserData(user);
+    schedule = built;
+    schedule.inflate(higher);
+    EXPECT_GT(schedule.expense_[30], 4000000000);
+    EXPECT_NEAR(schedule.expense_[30], built.expense_[30] * higher.growth[30], 0.001 * schedule.expense_[30]);
+}
+
+TEST(InflationModelTest, StudyKeepsTheInflationModel) {
+    const std::string file = "test_study_inflation.pfss";
+    const uint64_t seed = 13;
+    const unsigned int iterations = 1500;
+    std::vector<UserData> profiles = {makeTestUser("inflation")};
+    ThreadPool pool(2);
+
+    StudyState state = initStudy(profiles, seed, iterations, 0, iterations,
+                                 ModelOption::RECESSION_RANDOMIZED, InflationOption::STOCHASTIC);
+    state.endIteration = 500;
+    runStudy(profiles, state, pool, file, 0);
+
+    StudyState resumed = readStudyState(file);
+    EXPECT_EQ(resumed.inflation, InflationOption::STOCHASTIC);
+    EXPECT_NE(resumed.modelHash, scenarioModelHash(ModelOption::RECESSION_RANDOMIZED));
+    resumed.endIteration = iterations;
+    runStudy(profiles, resumed, pool, file, 0);
+    std::remove(file.c_str());
+
+    ScenarioBank bank(seed, iterations, nullptr, ModelOption::RECESSION_RANDOMIZED, InflationOption::STOCHASTIC);
+    SimResult expected = simulateProfile(profiles[0], bank);
+    EXPECT_EQ(resumed.results[0].inflation, InflationOption::STOCHASTIC);
+    EXPECT_EQ(resumed.results[0].longevityCounts, expected.longevityCounts);
+
+    /* Random inflation does change the outcome */
+    ScenarioBank constant(seed, iterations);
+    EXPECT_NE(simulateProfile(profiles[0], constant).longevityCounts, expected.longevityCounts);
+}
@@ -0,0 +1,183 @@
+/* ============================================================================
+ * test_modelMortality.cpp
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Minimum unit tests for the life-table mortality model.
+ *
+ *  Created: 	October 2026
+ *  Maintainer: Yuping X
+ * ============================================================================
+ */
+#include <gtest/gtest.h>
+#include <fstream>
+#include <cstdio>
+#include <vector>
+#include "modelMortality.h"
+#include "resultCache.h"
+#include "scenarioBank.h"
+#include "studyRun.h"
+#include "threadPool.h"
+#include "testProfiles.h"
+
+/* Writes a table where men die with probability 0.5 and women with
+ * probability 1 at every age */
+static void writeTestTable(const std::string& filename, unsigned int ages) {
+    std::ofstream file(filename);
+    file << "# test table\nAge,Male,Female\n";
+    for (unsigned int age = 0; age < ages; age++) {
+        file << age << "," << ((age + 1 < ages) ? 0.5 : 1.0) << ",1\n";
+    }
+}
+
+/* Mean of the tabulated years of death of an age and sex */
+static double meanYearsLeft(const LifeTable& table, unsigned int sex, unsigned int age) {
+    const uint8_t* years = table.quantiles(sex, age);
+    double sum = 0.0;
+    for (unsigned int j = 0; j < MORTALITY_TABLE_SIZE; j++) {
+        sum += years[j];
+    }
+    return sum / MORTALITY_TABLE_SIZE;
+}
+
+/* A retiree whose savings last about 30 years under the randomized model */
+static UserData makeThirtyYearRetiree(unsigned short birthYear) {
+    UserData user = makeNamedUser("retiree");
+    for (int c = 0; c < MAX_ACCOUNTS; c++) {
+        user.value[c] = 300000;
+        user.rate[c] = 0.06f;
+    }
+    user.initialExpense = 90000;
+    user.pensionEstimate = 20000;
+    user.initialInflation = 0.03f;
+    user.yearsTillPension = 2;
+    user.birthYear = birthYear;
+    user.sex = SEX_MALE;
+    return user;
+}
+
+TEST(LifeTableTest, QuantilesInvertTheSurvivalCurve) {
+    const std::string TESTFILE = "test_life_table.csv";
+    writeTestTable(TESTFILE, LIFE_TABLE_AGES);
+    LifeTable table(TESTFILE);
+    std::remove(TESTFILE.c_str());
+
+    /* Half of the men die this year, a quarter next year, ... */
+    const uint8_t* male = table.quantiles(SEX_MALE, 30);
+    EXPECT_EQ(male[0], 0);
+    EXPECT_EQ(male[MORTALITY_TABLE_SIZE / 2 - 1], 0);
+    EXPECT_EQ(male[MORTALITY_TABLE_SIZE / 2], 1);
+    EXPECT_EQ(male[3 * MORTALITY_TABLE_SIZE / 4 - 1], 1);
+    EXPECT_EQ(male[3 * MORTALITY_TABLE_SIZE / 4], 2);
+    EXPECT_EQ(LifeTable::deathYear(male, 0x7fffffffu), 0u);
+    EXPECT_EQ(LifeTable::deathYear(male, 0x80000000u), 1u);
+
+    /* ... while every woman dies this year, and without a sex three
+     * quarters do */
+    const uint8_t* female = table.quantiles(SEX_FEMALE, 30);
+    EXPECT_EQ(female[MORTALITY_TABLE_SIZE - 1], 0);
+    const uint8_t* unknown = table.quantiles(SEX_UNKNOWN, 30);
+    EXPECT_EQ(unknown[3 * MORTALITY_TABLE_SIZE / 4 - 1], 0);
+    EXPECT_EQ(unknown[3 * MORTALITY_TABLE_SIZE / 4], 1);
+
+    /* Nobody outlives the table, and older ages are taken as its last */
+    EXPECT_EQ(table.quantiles(SEX_MALE, LIFE_TABLE_AGES - 2)[MORTALITY_TABLE_SIZE - 1], 1);
+    EXPECT_EQ(table.quantiles(SEX_MALE, 200), table.quantiles(SEX_MALE, LIFE_TABLE_AGES - 1));
+    EXPECT_EQ(table.quantiles(SEX_MALE, LIFE_TABLE_AGES - 1)[MORTALITY_TABLE_SIZE - 1], 0);
+}
+
+TEST(LifeTableTest, RejectsMalformedTables) {
+    const std::string TESTFILE = "test_bad_life_table.csv";
+    writeTestTable(TESTFILE, LIFE_TABLE_AGES - 1);
+    EXPECT_THROW(LifeTable table(TESTFILE), std::runtime_error);
+
+    std::ofstream(TESTFILE) << "Age,Female,Male\n0,0.5,0.5\n";
+    EXPECT_THROW(LifeTable table(TESTFILE), std::runtime_error);
+
+    std::ofstream(TESTFILE) << "Age,Male,Female\n0,1.5,0.5\n";
+    EXPECT_THROW(LifeTable table(TESTFILE), std::runtime_error);
+
+    std::ofstream(TESTFILE) << "Age,Male,Female\n1,0.5,0.5\n";
+    EXPECT_THROW(LifeTable table(TESTFILE), std::runtime_error);
+    std::remove(TESTFILE.c_str());
+
+    EXPECT_THROW(LifeTable table("no_such_life_table.csv"), std::runtime_error);
+}
+
+TEST(LifeTableTest, SharedTableGivesPlausibleLifeExpectancies) {
+    const LifeTable& table = LifeTable::shared();
+
+    /* Remaining life expectancy at 65 of about 18 and 21 years */
+    double male = meanYearsLeft(table, SEX_MALE, 65);
+    double female = meanYearsLeft(table, SEX_FEMALE, 65);
+    EXPECT_NEAR(male, 17.5, 2.0);
+    EXPECT_NEAR(female, 20.5, 2.0);
+    EXPECT_LT(male, meanYearsLeft(table, SEX_UNKNOWN, 65));
+    EXPECT_LT(meanYearsLeft(table, SEX_UNKNOWN, 65), female);
+
+    /* The quantiles increase, and the young have further to go */
+    const uint8_t* years = table.quantiles(SEX_FEMALE, 65);
+    for (unsigned int j = 1; j < MORTALITY_TABLE_SIZE; j++) {
+        EXPECT_LE(years[j - 1], years[j]);
+    }
+    EXPECT_GT(meanYearsLeft(table, SEX_MALE, 40), male + 20);
+
+    /* A profile without a birth year runs the full horizon */
+    UserData user = makeThirtyYearRetiree(0);
+    EXPECT_EQ(profileLifeQuantiles(user, table), nullptr);
+    user.birthYear = CURRENT_YEAR - 65;
+    EXPECT_EQ(profileLifeQuantiles(user, table), table.quantiles(SEX_MALE, 65));
+}
+
+TEST(LifeTableTest, DeathYearEndsTheRandomizedPaths) {
+    const std::string file = "test_study_mortality.pfss";
+    const uint64_t seed = 23;
+    const unsigned int iterations = 2000;
+    ScenarioBank plain(seed, iterations);
+    ScenarioBank bank(seed, iterations, nullptr, ModelOption::RECESSION_RANDOMIZED,
+                      InflationOption::CONSTANT, TaxOption::NONE, StepOption::ANNUAL,
+                      MortalityOption::LIFE_TABLE);
+
+    /* The death draws come after the growth, which stays the same */
+    for (size_t i = 0; i < iterations; i += 100) {
+        EXPECT_EQ(plain[i], bank[i]);
+    }
+    EXPECT_NE(scenarioModelHash(ModelOption::RECESSION_RANDOMIZED),
+              scenarioModelHash(ModelOption::RECESSION_RANDOMIZED, InflationOption::CONSTANT,
+                                TaxOption::NONE, StepOption::ANNUAL, MortalityOption::LIFE_TABLE));
+
+    /* Without a birth year, the mortality model changes nothing */
+    UserData ageless = makeThirtyYearRetiree(0);
+    SimResult fixed = simulateProfile(ageless, plain);
+    EXPECT_EQ(simulateProfile(ageless, bank).longevityCounts, fixed.longevityCounts);
+    EXPECT_LT(fixed.longevityCounts[MAX_YEARS], iterations / 2);
+
+    /* A 90-year-old almost surely dies before the money runs out; a
+     * 50-year-old less surely, but more often than the full horizon says */
+    UserData elder = makeThirtyYearRetiree(CURRENT_YEAR - 90);
+    SimResult old = simulateProfile(elder, bank);
+    EXPECT_EQ(old.mortality, MortalityOption::LIFE_TABLE);
+    EXPECT_GT(old.longevityCounts[MAX_YEARS], iterations * 99 / 100);
+    SimResult young = simulateProfile(makeThirtyYearRetiree(CURRENT_YEAR - 50), bank);
+    EXPECT_LT(young.longevityCounts[MAX_YEARS], old.longevityCounts[MAX_YEARS]);
+    EXPECT_GT(young.longevityCounts[MAX_YEARS], fixed.longevityCounts[MAX_YEARS]);
+
+    /* The deterministic models still run the full horizon */
+    EXPECT_EQ(old.constantLongevity, simulateProfile(elder, plain).constantLongevity);
+
+    /* Studies keep the mortality model across a resume */
+    std::vector<UserData> profiles = {makeThirtyYearRetiree(CURRENT_YEAR - 50)};
+    ThreadPool pool(2);
+    StudyState state = initStudy(profiles, seed, iterations, 0, iterations,
+                                 ModelOption::RECESSION_RANDOMIZED, InflationOption::CONSTANT,
+                                 TaxOption::NONE, StepOption::ANNUAL, MortalityOption::LIFE_TABLE);
+    state.endIteration = 500;
+    runStudy(profiles, state, pool, file, 0);
+
+    StudyState resumed = readStudyState(file);
+    EXPECT_EQ(resumed.mortality, MortalityOption::LIFE_TABLE);
+    resumed.endIteration = iterations;
+    runStudy(profiles, resumed, pool, file, 0);
+    std::remove(file.c_str());
+    EXPECT_EQ(resumed.results[0].longevityCounts, young.longevityCounts);
+}
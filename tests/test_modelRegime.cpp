@@ -0,0 +1,88 @@
+/* ============================================================================
+ * test_modelRegime.cpp
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Minimum unit tests for alias tables and the Markov regime-switching
+ *  growth model.
+ *
+ *  Created: 	October 2026
+ *  Maintainer: Yuping X
+ * ============================================================================
+ */
+#include <gtest/gtest.h>
+#include <fstream>
+#include <cstdio>
+#include <cmath>
+#include "aliasTable.h"
+#include "modelRegime.h"
+#include "scenarioRng.h"
+
+TEST(AliasTableTest, SamplesTheGivenDistribution) {
+    std::vector<double> weights = {1, 0, 3, 6};
+    AliasTable table(weights);
+    ASSERT_EQ(table.size(), 4u);
+
+    const int SAMPLES = 200000;
+    std::vector<int> counts(weights.size(), 0);
+    ScenarioRng generator(1, 0);
+    for (int i = 0; i < SAMPLES; i++) {
+        counts[table.sample(generator())]++;
+    }
+    EXPECT_EQ(counts[1], 0);
+    for (size_t i = 0; i < weights.size(); i++) {
+        EXPECT_NEAR(double(counts[i]) / SAMPLES, weights[i] / 10, 0.005);
+    }
+
+    EXPECT_THROW(AliasTable(std::vector<double>{}), std::runtime_error);
+    EXPECT_THROW(AliasTable(std::vector<double>{0, 0}), std::runtime_error);
+    EXPECT_THROW(AliasTable(std::vector<double>{1, -1}), std::runtime_error);
+}
+
+TEST(RegimeModelTest, FollowsTheTransitions) {
+    /* Recession always follows expansion, and recovery recession; the
+     * regimes' returns tell them apart */
+    const std::string TESTFILE = "test_regime_model.ini";
+    std::ofstream(TESTFILE) << "# test model\n"
+        "Expansion-next = 0, 1, 0\n"
+        "Recession-next = 0, 0, 1\n"
+        "Recovery-next = 1, 0, 0\n"
+        "Expansion-returns = 0.1:1, 0.2:1\n"
+        "Recession-returns = -0.3:1\n"
+        "Recovery-returns = 0.4:1\n";
+    RegimeModel model(TESTFILE);
+    std::remove(TESTFILE.c_str());
+
+    for (uint64_t iter = 0; iter < 100; iter++) {
+        ScenarioRng generator(5, iter);
+        std::array<float, MAX_YEARS> growth;
+        generateRegimeSwitching(growth, generator, model);
+        for (unsigned int n = 1; n < MAX_YEARS; n++) {
+            if (growth[n - 1] > 0.35f) {
+                EXPECT_GT(growth[n], 0.05f);
+                EXPECT_LT(growth[n], 0.25f);
+            }
+            else if (growth[n - 1] < 0) {
+                EXPECT_FLOAT_EQ(growth[n], 0.4f);
+            }
+            else {
+                EXPECT_FLOAT_EQ(growth[n], -0.3f);
+            }
+        }
+    }
+}
+
+TEST(RegimeModelTest, RejectsInvalidModels) {
+    const std::string TESTFILE = "test_bad_regime_model.ini";
+    std::ofstream(TESTFILE) << "Expansion-next = 0.5, 0.4, 0\n"
+        "Recession-next = 0, 0, 1\n"
+        "Recovery-next = 1, 0, 0\n"
+        "Expansion-returns = 0.1:1\n"
+        "Recession-returns = -0.3:1\n"
+        "Recovery-returns = 0.4:1\n";
+    EXPECT_THROW(RegimeModel model(TESTFILE), std::runtime_error);
+
+    std::ofstream(TESTFILE) << "Expansion-next = 1, 0, 0\n";
+    EXPECT_THROW(RegimeModel model(TESTFILE), std::runtime_error);
+    std::remove(TESTFILE.c_str());
+}
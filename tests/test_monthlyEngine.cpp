@@ -0,0 +1,163 @@
+/* ============================================================================
+ * test_monthlyEngine.cpp
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Minimum unit tests for the monthly time-step engine.
+ *
+ *  Created: 	October 2026
+ *  Maintainer: Yuping X
+ * ============================================================================
+ */
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+#include "monthlyEngine.h"
+#include "asset.h"
+#include "profileSchedule.h"
+#include "resultCache.h"
+#include "scenarioBank.h"
+#include "studyRun.h"
+#include "threadPool.h"
+#include "testProfiles.h"
+
+TEST(MonthlyEngineTest, BridgeIsTiedDownAtTheYearEnds) {
+    const size_t PATHS = 4000;
+    const unsigned int MID = MONTHS_PER_YEAR / 2;
+    const unsigned int QUARTER = MONTHS_PER_YEAR / 4;
+    double sumMid = 0, squaresMid = 0, squaresQuarter = 0;
+    MonthlyBridge bridge;
+    for (size_t p = 0; p < PATHS; p++) {
+        ScenarioRng generator(11, p);
+        generateMonthlyBridge(bridge, generator);
+        for (unsigned int n = 0; n < MAX_YEARS; n += 7) {
+            ASSERT_EQ(bridge[n * MONTHS_PER_YEAR], 0.0f);
+        }
+        sumMid += bridge[MID];
+        squaresMid += double(bridge[MID]) * bridge[MID];
+        squaresQuarter += double(bridge[QUARTER]) * bridge[QUARTER];
+    }
+
+    /* A Brownian bridge over one year has variance t (1 - t) at time t */
+    EXPECT_NEAR(sumMid / PATHS, 0.0, 0.03);
+    EXPECT_NEAR(squaresMid / PATHS, 0.25, 0.02);
+    EXPECT_NEAR(squaresQuarter / PATHS, 0.1875, 0.015);
+}
+
+TEST(MonthlyEngineTest, GrowthWithoutCashFlowsMatchesAnnualSteps) {
+    UserData user = makeTestUser("monthly");
+    user.initialExpense = 0;
+    user.takehomeIncome = 0;
+    user.contributionRoth = 0;
+    user.contributionIra = 0;
+    user.contributionR401k = 0;
+    user.pensionEstimate = 0;
+
+    Asset annual, monthly;
+    ProfileSchedule schedule;
+    MonthlySchedule monthlySchedule;
+    schedule.initializeFromUserData(user);
+    monthlySchedule.initializeFromSchedule(schedule);
+    annual.initializeFromUserData(user);
+    monthly.initializeFromUserData(user);
+    annual.populateGrowthCurves(ModelOption::CONSTANT);
+    monthly.populateGrowthCurves(ModelOption::CONSTANT);
+    annual.calculateN(schedule);
+    monthly.calculateMonthlyN(monthlySchedule, nullptr);
+
+    EXPECT_EQ(monthly.getFundLongevity(), MAX_YEARS);
+    for (int c = 0; c < MAX_ACCOUNTS; c++) {
+        for (int n = 0; n < MAX_YEARS; n += 10) {
+            EXPECT_NEAR(monthly.value_[c][n], annual.value_[c][n], 1e-4 * annual.value_[c][n] + 1);
+        }
+    }
+}
+
+TEST(MonthlyEngineTest, MonthlyDistributionsCoverTheExpense) {
+    /* Distributing from every account while still contributing to them */
+    UserData user = makeTestUser("monthly");
+    user.initialExpense = 90000;
+    user.yearsTillWithdrawal = 0;
+    Asset annual, monthly;
+    ProfileSchedule schedule;
+    MonthlySchedule monthlySchedule;
+    schedule.initializeFromUserData(user);
+    monthlySchedule.initializeFromSchedule(schedule);
+    annual.initializeFromUserData(user);
+    monthly.initializeFromUserData(user);
+    annual.populateGrowthCurves(ModelOption::CONSTANT);
+    monthly.populateGrowthCurves(ModelOption::CONSTANT);
+    annual.calculateN(schedule);
+    monthly.calculateMonthlyN(monthlySchedule, nullptr);
+
+    /* Every covered year distributes its net expense, whether it is
+     * stepped month by month (contributing) or in closed form */
+    ASSERT_GT(monthly.getFundLongevity(), 20);
+    ASSERT_LT(monthly.getFundLongevity(), MAX_YEARS);
+    for (int n = 0; n < monthly.getFundLongevity(); n++) {
+        long int distributed = 0;
+        for (int c = 0; c < MAX_ACCOUNTS; c++) {
+            distributed += monthly.distribution_[c][n];
+        }
+        EXPECT_NEAR(distributed, std::max<long int>(schedule.netExpense_[n], 0), 4);
+    }
+
+    /* Money spent through the year stays invested longer than with a
+     * distribution at the start of the year, but not by much */
+    EXPECT_GE(monthly.getFundLongevity(), annual.getFundLongevity());
+    EXPECT_LE(monthly.getFundLongevity(), annual.getFundLongevity() + 5);
+}
+
+TEST(MonthlyEngineTest, StudyKeepsTheTimeStep) {
+    const std::string file = "test_study_monthly.pfss";
+    const uint64_t seed = 17;
+    const unsigned int iterations = 1200;
+    std::vector<UserData> profiles = {makeTestUser("monthly")};
+    ThreadPool pool(2);
+
+    StudyState state = initStudy(profiles, seed, iterations, 0, iterations,
+                                 ModelOption::RECESSION_RANDOMIZED, InflationOption::CONSTANT,
+                                 TaxOption::NONE, StepOption::MONTHLY);
+    state.endIteration = 400;
+    runStudy(profiles, state, pool, file, 0);
+
+    StudyState resumed = readStudyState(file);
+    EXPECT_EQ(resumed.step, StepOption::MONTHLY);
+    EXPECT_NE(resumed.modelHash, scenarioModelHash(ModelOption::RECESSION_RANDOMIZED));
+    resumed.endIteration = iterations;
+    runStudy(profiles, resumed, pool, file, 0);
+    std::remove(file.c_str());
+
+    ScenarioBank bank(seed, iterations, nullptr, ModelOption::RECESSION_RANDOMIZED,
+                      InflationOption::CONSTANT, TaxOption::NONE, StepOption::MONTHLY);
+    SimResult expected = simulateProfile(profiles[0], bank);
+    EXPECT_EQ(resumed.results[0].step, StepOption::MONTHLY);
+    EXPECT_EQ(resumed.results[0].longevityCounts, expected.longevityCounts);
+
+    /* The bridges are drawn after the growth, which stays the same */
+    ScenarioBank annual(seed, iterations);
+    for (size_t i = 0; i < iterations; i += 100) {
+        EXPECT_EQ(annual[i], bank[i]);
+    }
+    EXPECT_NE(simulateProfile(profiles[0], annual).longevityCounts, expected.longevityCounts);
+}
+
+TEST(MonthlyEngineTest, RejectsWhatMonthlyStepsDoNotModel) {
+    ScenarioBank bank(3, 100, nullptr, ModelOption::RECESSION_RANDOMIZED,
+                      InflationOption::CONSTANT, TaxOption::NONE, StepOption::MONTHLY);
+    ScenarioBank annual(3, 100);
+    UserData user = makeTestUser("monthly");
+    EXPECT_NO_THROW(simulateProfile(user, bank));
+
+    /* A spending rule or a cash reserve is an error, not ignored */
+    user.spendingRule = static_cast<unsigned short>(SpendingRule::GUARDRAILS);
+    EXPECT_THROW(simulateProfile(user, bank), std::runtime_error);
+    EXPECT_NO_THROW(simulateProfile(user, annual));
+    user.spendingRule = static_cast<unsigned short>(SpendingRule::FIXED);
+    user.cashReserveYears = 1.0f;
+    SimResult result;
+    EXPECT_THROW(simulateScenarios(user, bank, 0, bank.size(), result), std::runtime_error);
+    EXPECT_NO_THROW(simulateProfile(user, annual));
+}
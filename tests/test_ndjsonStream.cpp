@@ -0,0 +1,95 @@
+/* ============================================================================
+ * test_ndjsonStream.cpp
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Minimum unit tests for the NDJSON streaming pipeline.
+ *
+ *  Created: 	October 2026
+ *  Maintainer: Yuping X
+ * ============================================================================
+ */
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include "ndjsonStream.h"
+
+/* The demo profile as one NDJSON line, with the given sequence number */
+static std::string demoLine(const std::string& seq) {
+    return "{" + seq + "\"id\": \"demo\", \"Individual\": 40000, \"Individual-rate\": 0.06, "
+           "\"Individual_roth\": 40000, \"Individual_roth-rate\": 0.08, "
+           "\"Individual_ira\": 24000, \"Individual_ira-rate\": 0.07, "
+           "\"401k\": 80000, \"401k-rate\": 0.09, "
+           "\"Cost-of-living\": 80000, \"Current-annual-takehome-income\": 80000, "
+           "\"Current-annual-roth-contribution\": 4000, \"Current-annual-ira-contribution\": 0, "
+           "\"Current-annual-r401k-contribution\": 16000, \"Pension-estimate\": 15000, "
+           "\"Inflation\": 0.04, \"Years-till-retirement\": 20, "
+           "\"Years-till-withdrawal\": 20, \"Years-till-pension\": 20}";
+}
+
+TEST(NdjsonStreamTest, ParseProfile) {
+    UserData user{};
+    StreamRequest request;
+    parseProfileJson(demoLine("\"seq\": 12, \"deadline_ms\": 50, "), user, request);
+    EXPECT_TRUE(request.hasSeq);
+    EXPECT_EQ(request.seq, 12u);
+    EXPECT_EQ(request.deadlineMs, 50u);
+    EXPECT_EQ(user.profileId, "demo");
+    EXPECT_EQ(user.value[3], 80000);
+    EXPECT_FLOAT_EQ(user.rate[1], 0.08f);
+    EXPECT_EQ(user.initialExpense, 80000);
+    EXPECT_FLOAT_EQ(user.initialInflation, 0.04f);
+    EXPECT_EQ(user.yearsTillPension, 20);
+    EXPECT_TRUE(userDataWithinBounds(user, false));
+
+    UserData other{};
+    StreamRequest otherRequest;
+    parseProfileJson(demoLine(""), other, otherRequest);
+    EXPECT_FALSE(otherRequest.hasSeq);
+    EXPECT_EQ(otherRequest.deadlineMs, 0u);
+    EXPECT_EQ(other.birthYear, 0);
+
+    /* The birth year is optional */
+    parseProfileJson(demoLine("\"Birth-year\": 1960, "), other, otherRequest);
+    EXPECT_EQ(other.birthYear, 1960);
+    EXPECT_THROW(parseProfileJson("{\"id\": \"x\"}", other, otherRequest), std::runtime_error);
+    EXPECT_THROW(parseProfileJson(demoLine("\"Inflation\": 0.04, "), other, otherRequest), std::runtime_error);
+    EXPECT_THROW(parseProfileJson(demoLine("\"Bogus\": 1, "), other, otherRequest), std::runtime_error);
+    EXPECT_THROW(parseProfileJson(demoLine("") + " x", other, otherRequest), std::runtime_error);
+}
+
+TEST(NdjsonStreamTest, ResultsInInputOrder) {
+    std::stringstream in;
+    for (int i = 0; i < 20; i++) {
+        in << ((i == 5) ? "{\"id\": \"bad\"}" : demoLine("")) << "\n";
+        if (i == 10) {
+            in << "\n";
+        }
+    }
+
+    ThreadPool pool(4);
+    ScenarioBank bank(7, 100, &pool);
+    std::stringstream out;
+    StreamOptions options;
+    options.maxInFlight = 3;
+    StreamStats stats = runNdjsonStream(in, out, bank, pool, options);
+    EXPECT_EQ(stats.lines, 20u);
+    EXPECT_EQ(stats.errors, 1u);
+
+    UserData user{};
+    StreamRequest request;
+    parseProfileJson(demoLine(""), user, request);
+    const std::string expected = formatResultJson(0, simulateProfile(user, bank));
+
+    std::string line;
+    for (int i = 0; std::getline(out, line); i++) {
+        std::string prefix = "{\"seq\":" + std::to_string(i) + ",";
+        ASSERT_EQ(line.compare(0, prefix.size(), prefix), 0) << line;
+        if (i == 5) {
+            EXPECT_NE(line.find("\"error\""), std::string::npos);
+        }
+        else {
+            EXPECT_EQ(line.substr(prefix.size()), expected.substr(std::string("{\"seq\":0,").size()));
+        }
+    }
+}
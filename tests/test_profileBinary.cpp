@@ -0,0 +1,90 @@
+/* ============================================================================
+ * test_profileBinary.cpp
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Minimum unit tests for the compiled binary profile format.
+ *
+ *  Created: 	October 2026
+ *  Maintainer: Yuping X
+ * ============================================================================
+ */
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <fstream>
+#include <vector>
+#include "profileBinary.h"
+#include "testProfiles.h"
+
+TEST(ProfileBinaryTest, RoundTrip) {
+    const std::string TESTFILE = "test_profiles.pfsb";
+    std::vector<UserData> profiles;
+    for (int i = 0; i < 100; i++) {
+        profiles.push_back(makeTestUser("household-" + std::to_string(i), 40000 + i));
+    }
+    writeCompiledProfiles(TESTFILE, profiles);
+
+    CompiledProfiles compiled(TESTFILE);
+    ASSERT_EQ(compiled.size(), profiles.size());
+    for (size_t i = 0; i < compiled.size(); i++) {
+        UserData user;
+        userDataFromRecord(compiled[i], user);
+        EXPECT_EQ(user.profileId, profiles[i].profileId);
+        EXPECT_EQ(user.name[R401K_INDEX], profiles[i].name[R401K_INDEX]);
+        EXPECT_EQ(user.value[ROTH_INDEX], profiles[i].value[ROTH_INDEX]);
+        EXPECT_EQ(user.rate[IRA_INDEX], profiles[i].rate[IRA_INDEX]);
+        EXPECT_EQ(user.initialExpense, profiles[i].initialExpense);
+        EXPECT_EQ(user.initialInflation, profiles[i].initialInflation);
+        EXPECT_EQ(user.yearsTillPension, profiles[i].yearsTillPension);
+    }
+
+    std::remove(TESTFILE.c_str());
+}
+
+TEST(ProfileBinaryTest, CorruptedFileFailsChecksum) {
+    const std::string TESTFILE = "test_profiles.pfsb";
+    writeCompiledProfiles(TESTFILE, {makeTestUser("a", 40000), makeTestUser("b", 41000)});
+
+    /* Flip one byte of the second record */
+    std::fstream file(TESTFILE, std::ios::in | std::ios::out | std::ios::binary);
+    file.seekp(sizeof(ProfileBinaryHeader) + sizeof(ProfileRecord) + 200);
+    file.put('\x7f');
+    file.close();
+
+    try {
+        CompiledProfiles compiled(TESTFILE);
+        FAIL() << "Expected exception not thrown";
+    } catch (const std::runtime_error& e) {
+        EXPECT_TRUE(std::string(e.what()).find("checksum") != std::string::npos);
+    }
+
+    std::remove(TESTFILE.c_str());
+}
+
+TEST(ProfileBinaryTest, WrappingRecordCountIsRejected) {
+    const std::string TESTFILE = "test_profiles.pfsb";
+    writeCompiledProfiles(TESTFILE, {makeTestUser("a", 40000), makeTestUser("b", 41000)});
+
+    /* A count whose product with the record size wraps to the real size */
+    static_assert(sizeof(ProfileRecord) % 8 == 0, "the count below wraps with 8-byte multiples");
+    uint64_t count = 2 + (uint64_t(1) << 61);
+    std::fstream file(TESTFILE, std::ios::in | std::ios::out | std::ios::binary);
+    file.seekp(offsetof(ProfileBinaryHeader, recordCount));
+    file.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    file.close();
+
+    try {
+        CompiledProfiles compiled(TESTFILE);
+        FAIL() << "Expected exception not thrown";
+    } catch (const std::runtime_error& e) {
+        EXPECT_TRUE(std::string(e.what()).find("unexpected size") != std::string::npos);
+    }
+
+    std::remove(TESTFILE.c_str());
+}
+
+TEST(ProfileBinaryTest, OutOfBoundsProfileIsNotCompiled) {
+    const std::string TESTFILE = "test_profiles.pfsb";
+    EXPECT_THROW(writeCompiledProfiles(TESTFILE, {makeTestUser("negative", -1)}), std::runtime_error);
+    std::remove(TESTFILE.c_str());
+}
@@ -0,0 +1,167 @@
+/* ============================================================================
+ * test_profileSchedule.cpp
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Minimum unit tests for the ProfileSchedule class.
+ *
+ *  Created: 	October 2026
+ *  Maintainer: Yuping X
+ * ============================================================================
+ */
+#include <gtest/gtest.h>
+#include "asset.h"
+#include "profileSchedule.h"
+#include "modelRecession.h"
+#include "testProfiles.h"
+
+TEST(ProfileScheduleTest, CashFlowsFromUserData) {
+    UserData user = makeTestUser("schedule", 50000);
+    ProfileSchedule schedule;
+    schedule.initializeFromUserData(user);
+
+    const int R = user.yearsTillRetirement;
+    const int W = user.yearsTillWithdrawal;
+    const int P = user.yearsTillPension;
+
+    EXPECT_EQ(schedule.expense_[0], user.initialExpense);
+    EXPECT_EQ(schedule.income_[0], user.takehomeIncome);
+    EXPECT_EQ(schedule.contribution_[INDIVIDUAL_INDEX][0],
+              user.takehomeIncome - user.initialExpense);
+    EXPECT_EQ(schedule.netExpense_[0], 0);
+
+    for (int i = 1; i < MAX_YEARS; i++) {
+        /* Expense grows with inflation every year */
+        EXPECT_GT(schedule.expense_[i], schedule.expense_[i - 1]);
+        /* No income or contributions from retirement on */
+        if (i >= R) {
+            EXPECT_EQ(schedule.income_[i], 0);
+            for (int c = 0; c < MAX_ACCOUNTS; c++) {
+                EXPECT_EQ(schedule.contribution_[c][i], 0);
+            }
+        }
+        EXPECT_EQ(schedule.pension_[i] > 0, i >= P);
+        EXPECT_TRUE(schedule.availability_[INDIVIDUAL_INDEX][i]);
+        EXPECT_EQ(schedule.availability_[IRA_INDEX][i], i >= W);
+        EXPECT_EQ(schedule.netExpense_[i],
+                  std::max(schedule.expense_[i] - schedule.income_[i] - schedule.pension_[i], 0L));
+    }
+}
+
+TEST(ProfileScheduleTest, ScheduleKernelMatchesMemberPath) {
+    /* Simulating from a schedule built once must give the same results as
+     * simulating from a freshly initialized Asset */
+    UserData user = makeTestUser("schedule", 50000);
+
+    Asset fromMembers;
+    fromMembers.initializeFromUserData(user);
+    fromMembers.populateGrowthCurves(ModelOption::PREDEFINED_YEAR0_LOSS);
+    fromMembers.calculateN();
+
+    Asset fromSchedule;
+    ProfileSchedule schedule;
+    fromSchedule.initializeFromUserData(user);
+    schedule.initializeFromUserData(user);
+    for (int iter = 0; iter < 3; iter++) {
+        fromSchedule.populateGrowthCurves(ModelOption::PREDEFINED_YEAR0_LOSS);
+        fromSchedule.calculateN(schedule);
+
+        EXPECT_EQ(fromSchedule.getFundLongevity(), fromMembers.getFundLongevity());
+        for (int c = 0; c < MAX_ACCOUNTS; c++) {
+            for (int y = 0; y < fromMembers.getFundLongevity(); y++) {
+                EXPECT_EQ(fromSchedule.value_[c][y], fromMembers.value_[c][y]);
+                EXPECT_EQ(fromSchedule.distribution_[c][y], fromMembers.distribution_[c][y]);
+            }
+        }
+    }
+}
+
+TEST(ProfileScheduleTest, AccumulationFastPathEligibility) {
+    UserData user = makeTestUser("schedule", 50000);
+    ProfileSchedule schedule;
+    schedule.initializeFromUserData(user);
+    EXPECT_TRUE(schedule.accumulationFastPath_);
+
+    /* Expenses exceeding income before retirement need the full loop */
+    user.initialExpense = user.takehomeIncome + 1;
+    schedule.initializeFromUserData(user);
+    EXPECT_FALSE(schedule.accumulationFastPath_);
+}
+
+TEST(ProfileScheduleTest, AccumulationFastPathValues) {
+    /* The fast-forwarded retirement-year values must match a year-by-year
+     * recurrence of value * growth + contribution */
+    UserData user = makeTestUser("schedule", 50000);
+    ProfileSchedule schedule;
+    Asset myAsset;
+    myAsset.initializeFromUserData(user);
+    schedule.initializeFromUserData(user);
+    myAsset.populateGrowthCurves(ModelOption::PREDEFINED_YEAR0_LOSS);
+    myAsset.calculateN(schedule);
+
+    const int R = user.yearsTillRetirement;
+    float stockRatio;
+    for (int c = 0; c < MAX_ACCOUNTS; c++) {
+        stockRatio = std::min(user.rate[c] / STOCK_GROWTH_AVG, 1.0f);
+        double expected = user.value[c];
+        for (int y = 0; y < R; y++) {
+            expected = expected * (1.0 + RECESSION_YEAR0_LOSS[y] * stockRatio) \
+                       + schedule.contribution_[c][y];
+            EXPECT_EQ(myAsset.distribution_[c][y], 0);
+        }
+        EXPECT_NEAR(myAsset.value_[c][R], expected, 1.0);
+    }
+}
+
+TEST(ProfileScheduleTest, LifeEventsOverlayTheExpense) {
+    /* Savings small enough to run out within the horizon */
+    UserData user = makeTestUser("schedule", 50000);
+    for (int c = 0; c < MAX_ACCOUNTS; c++) {
+        user.value[c] = 10000 * (c + 1);
+    }
+    ProfileSchedule plain, schedule;
+    plain.initializeFromUserData(user);
+
+    /* College before retirement, a gift received in retirement */
+    for (int i = 2; i < 6; i++) {
+        user.eventExpense[i] = 20000;
+    }
+    user.eventExpense[20] = -10000;
+    schedule.initializeFromUserData(user);
+
+    for (int i = 0; i < MAX_YEARS; i++) {
+        long int event = static_cast<long int>(user.eventExpense[i] * schedule.priceLevel_[i]);
+        EXPECT_EQ(schedule.expense_[i], plain.expense_[i] + event);
+        EXPECT_EQ(schedule.netExpense_[i],
+                  std::max(schedule.expense_[i] - schedule.income_[i] - schedule.pension_[i], 0L));
+        if (i < user.yearsTillRetirement) {
+            EXPECT_EQ(schedule.contribution_[INDIVIDUAL_INDEX][i],
+                      std::max(schedule.income_[i] + schedule.pension_[i] - schedule.expense_[i], 0L));
+        }
+    }
+    EXPECT_GT(schedule.netExpense_[2], 0);
+    EXPECT_LT(schedule.netExpense_[20], plain.netExpense_[20]);
+    EXPECT_FALSE(schedule.accumulationFastPath_);
+
+    /* Re-inflating with no deviation gives back the overlay */
+    InflationPath flat;
+    flat.deviation.fill(0.0f);
+    flat.growth.fill(1.0f);
+    ProfileSchedule inflated = schedule;
+    inflated.inflate(flat);
+    for (int i = 0; i < MAX_YEARS; i++) {
+        EXPECT_NEAR(inflated.expense_[i], schedule.expense_[i], 1e-3 * std::abs(schedule.expense_[i]) + 2);
+        EXPECT_NEAR(inflated.netExpense_[i], schedule.netExpense_[i], 1e-3 * schedule.netExpense_[i] + 2);
+    }
+    EXPECT_FALSE(inflated.accumulationFastPath_);
+
+    /* Spending more makes the money last no longer */
+    Asset before, after;
+    before.initializeFromUserData(user);
+    after.initializeFromUserData(user);
+    before.populateGrowthCurves(ModelOption::CONSTANT);
+    after.populateGrowthCurves(ModelOption::CONSTANT);
+    before.calculateN(plain);
+    after.calculateN(schedule);
+    EXPECT_LT(after.getFundLongevity(), before.getFundLongevity());
+}
@@ -0,0 +1,62 @@
+/* ============================================================================
+ * test_resultCache.cpp
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Minimum unit tests for the ResultCache class.
+ *
+ *  Created: 	October 2026
+ *  Maintainer: Yuping X
+ * ============================================================================
+ */
+#include <gtest/gtest.h>
+#include "resultCache.h"
+#include "testProfiles.h"
+
+TEST(ResultCacheTest, KeyIgnoresNamesOnly) {
+    ScenarioBank bank(7, 10);
+    ScenarioBank otherBank(8, 10);
+    UserData user = makeTestUser("a", 50000);
+    UserData renamed = makeTestUser("b", 50000);
+    renamed.name[0] = "Brokerage";
+    UserData changed = makeTestUser("a", 50001);
+
+    CacheKeyHash hash;
+    EXPECT_TRUE(makeCacheKey(user, bank) == makeCacheKey(renamed, bank));
+    EXPECT_EQ(hash(makeCacheKey(user, bank)), hash(makeCacheKey(renamed, bank)));
+    EXPECT_FALSE(makeCacheKey(user, bank) == makeCacheKey(changed, bank));
+    EXPECT_FALSE(makeCacheKey(user, bank) == makeCacheKey(user, otherBank));
+}
+
+TEST(ResultCacheTest, HitsAreIdenticalAndEvictionIsLru) {
+    ScenarioBank bank(7, 200);
+    ResultCache cache(2 * ResultCache::ENTRY_BYTES);
+
+    UserData a = makeTestUser("a", 50000);
+    UserData b = makeTestUser("b", 60000);
+    UserData c = makeTestUser("c", 70000);
+
+    SimResult fresh = simulateProfile(a, bank);
+    simulateProfileCached(a, bank, &cache);
+    simulateProfileCached(b, bank, &cache);
+
+    UserData again = makeTestUser("again", 50000);
+    SimResult cached = simulateProfileCached(again, bank, &cache);
+    EXPECT_EQ(cached.profileId, "again");
+    EXPECT_EQ(cached.longevityCounts, fresh.longevityCounts);
+    EXPECT_EQ(cached.predefinedLongevity, fresh.predefinedLongevity);
+    EXPECT_EQ(cached.constantLongevity, fresh.constantLongevity);
+
+    /* a was used more recently than b, so c evicts b */
+    simulateProfileCached(c, bank, &cache);
+    SimResult result;
+    EXPECT_TRUE(cache.lookup(makeCacheKey(a, bank), result));
+    EXPECT_FALSE(cache.lookup(makeCacheKey(b, bank), result));
+
+    CacheStats stats = cache.stats();
+    EXPECT_EQ(stats.hits, 2u);
+    EXPECT_EQ(stats.misses, 4u);
+    EXPECT_EQ(stats.evictions, 1u);
+    EXPECT_EQ(stats.entries, 2u);
+    EXPECT_LE(stats.bytes, 2 * ResultCache::ENTRY_BYTES);
+}
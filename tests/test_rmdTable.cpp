@@ -0,0 +1,124 @@
+/* ============================================================================
+ * test_rmdTable.cpp
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Minimum unit tests for the required minimum distributions.
+ *
+ *  Created: 	October 2026
+ *  Maintainer: Yuping X
+ * ============================================================================
+ */
+#include <gtest/gtest.h>
+#include "rmdTable.h"
+#include "asset.h"
+#include "profileSchedule.h"
+#include "modelRecession.h"
+#include "testProfiles.h"
+
+/* A retiree born in the given year, whose pension covers the expense,
+ * with savings in the individual account and the IRA */
+static UserData makeIraRetiree(unsigned short birthYear) {
+    UserData user = makeNamedUser("retiree");
+    for (int c = 0; c < MAX_ACCOUNTS; c++) {
+        user.rate[c] = 0.05f;
+    }
+    user.value[INDIVIDUAL_INDEX] = 100000;
+    user.value[IRA_INDEX] = 1000000;
+    user.initialExpense = 40000;
+    user.pensionEstimate = 40000;
+    user.initialInflation = 0.02f;
+    user.yearsTillWithdrawal = 10;
+    user.birthYear = birthYear;
+    return user;
+}
+
+TEST(RmdTableTest, AgeAndDivisorsFollowTheRules) {
+    EXPECT_EQ(rmdStartAge(1945), RMD_FIRST_AGE);
+    EXPECT_EQ(rmdStartAge(1950), 72);
+    EXPECT_EQ(rmdStartAge(1951), 73);
+    EXPECT_EQ(rmdStartAge(1959), 73);
+    EXPECT_EQ(rmdStartAge(1960), 75);
+    EXPECT_EQ(rmdStartAge(1990), 75);
+
+    EXPECT_FLOAT_EQ(rmdDivisor(72), 27.4f);
+    EXPECT_FLOAT_EQ(rmdDivisor(75), 24.6f);
+    EXPECT_FLOAT_EQ(rmdDivisor(100), 6.4f);
+    EXPECT_FLOAT_EQ(rmdDivisor(RMD_LAST_AGE), 2.0f);
+    EXPECT_FLOAT_EQ(rmdDivisor(RMD_LAST_AGE + 5), 2.0f);
+
+    /* The divisors fall with age */
+    for (int age = RMD_FIRST_AGE + 1; age <= RMD_LAST_AGE; age++) {
+        EXPECT_LT(rmdDivisor(age), rmdDivisor(age - 1));
+    }
+}
+
+TEST(RmdTableTest, ScheduleRequiresFromTheRmdAge) {
+    /* Turns 73 in year 3 */
+    UserData user = makeIraRetiree(1955);
+    ProfileSchedule schedule;
+    schedule.initializeFromUserData(user);
+
+    const int start = 1955 + 73 - CURRENT_YEAR;
+    EXPECT_EQ(schedule.rmdStartYear_, start);
+    for (int i = 0; i < MAX_YEARS; i++) {
+        if (i < start) {
+            EXPECT_EQ(schedule.rmdRate_[i], 0.0f);
+        }
+        else {
+            EXPECT_FLOAT_EQ(schedule.rmdRate_[i], 1.0f / rmdDivisor(CURRENT_YEAR + i - 1955));
+        }
+    }
+
+    /* The tax-deferred accounts can be distributed from the first required
+     * distribution on, before the withdrawal year */
+    EXPECT_FALSE(schedule.availability_[IRA_INDEX][start - 1]);
+    EXPECT_TRUE(schedule.availability_[IRA_INDEX][start]);
+    EXPECT_TRUE(schedule.availability_[R401K_INDEX][start]);
+    EXPECT_FALSE(schedule.availability_[ROTH_INDEX][start]);
+
+    /* Without a birth year, nothing is required */
+    user.birthYear = 0;
+    schedule.initializeFromUserData(user);
+    EXPECT_EQ(schedule.rmdStartYear_, int(MAX_YEARS));
+    for (int i = 0; i < MAX_YEARS; i++) {
+        EXPECT_EQ(schedule.rmdRate_[i], 0.0f);
+    }
+}
+
+TEST(RmdSimulationTest, ForcedDistributionsFlowIntoIndividualAccount) {
+    /* 75 in year 0, with nothing to spend */
+    UserData user = makeIraRetiree(1950);
+    Asset asset;
+    ProfileSchedule schedule;
+    asset.initializeFromUserData(user);
+    schedule.initializeFromUserData(user);
+    asset.populateGrowthCurves(ModelOption::CONSTANT);
+    asset.calculateN(schedule);
+
+    long int required = static_cast<long int>(user.value[IRA_INDEX] / rmdDivisor(75));
+    EXPECT_NEAR(asset.distribution_[IRA_INDEX][0], required, 1);
+    EXPECT_EQ(asset.distribution_[INDIVIDUAL_INDEX][0], 0);
+    EXPECT_NEAR(asset.value_[INDIVIDUAL_INDEX][1],
+                user.value[INDIVIDUAL_INDEX] * 1.05 + asset.distribution_[IRA_INDEX][0], 2);
+    EXPECT_NEAR(asset.value_[IRA_INDEX][1],
+                (user.value[IRA_INDEX] - asset.distribution_[IRA_INDEX][0]) * 1.05, 2);
+
+    /* The IRA keeps distributing at least its required share */
+    for (int i = 1; i < 10; i++) {
+        EXPECT_GE(asset.distribution_[IRA_INDEX][i],
+                  static_cast<long int>(asset.value_[IRA_INDEX][i] * schedule.rmdRate_[i]));
+    }
+
+    /* A larger net expense is distributed as before, with no excess */
+    user.pensionEstimate = 0;
+    user.initialExpense = 200000;
+    asset.initializeFromUserData(user);
+    schedule.initializeFromUserData(user);
+    asset.populateGrowthCurves(ModelOption::CONSTANT);
+    asset.calculateN(schedule);
+    EXPECT_NEAR(asset.distribution_[INDIVIDUAL_INDEX][0] + asset.distribution_[IRA_INDEX][0],
+                user.initialExpense, 2);
+    EXPECT_NEAR(asset.value_[INDIVIDUAL_INDEX][1],
+                (user.value[INDIVIDUAL_INDEX] - asset.distribution_[INDIVIDUAL_INDEX][0]) * 1.05, 2);
+}
@@ -0,0 +1,63 @@
+/* ============================================================================
+ * test_simServer.cpp
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Minimum unit tests for the SimServer class.
+ *
+ *  Created: 	October 2026
+ *  Maintainer: Yuping X
+ * ============================================================================
+ */
+#include <gtest/gtest.h>
+#include <string>
+#include <algorithm>
+#include <thread>
+#include <cstring>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "simServer.h"
+#include "ndjsonStream.h"
+
+/* Connects to the server and sends the text; returns everything it answers */
+static std::string request(const std::string& socketPath, const std::string& text) {
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    std::strcpy(address.sun_path, socketPath.c_str());
+    EXPECT_EQ(connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)), 0);
+
+    EXPECT_EQ(write(fd, text.data(), text.size()), static_cast<ssize_t>(text.size()));
+    shutdown(fd, SHUT_WR);
+
+    std::string answer;
+    char buffer[4096];
+    ssize_t n;
+    while ((n = read(fd, buffer, sizeof(buffer))) > 0) {
+        answer.append(buffer, n);
+    }
+    close(fd);
+    return answer;
+}
+
+TEST(SimServerTest, AnswersRequestsInOrder) {
+    const std::string socketPath = "/tmp/pfsim_test_" + std::to_string(getpid()) + ".sock";
+    ThreadPool pool(2);
+    ScenarioBank bank(7, 50, &pool);
+    SimServer server(socketPath, bank, pool);
+    std::thread serverThread([&server] { server.run(); });
+
+    /* Two connections in a row on the same warm server */
+    for (int connection = 0; connection < 2; connection++) {
+        std::string answer = request(socketPath, "{\"seq\": 3, \"id\": \"a\"}\nnot json\n");
+        size_t eol = answer.find('\n');
+        ASSERT_NE(eol, std::string::npos);
+        EXPECT_EQ(answer.compare(0, 9, "{\"seq\":3,"), 0) << answer;
+        EXPECT_EQ(answer.compare(eol + 1, 9, "{\"seq\":1,"), 0) << answer;
+        EXPECT_EQ(std::count(answer.begin(), answer.end(), '\n'), 2);
+    }
+
+    server.stop();
+    serverThread.join();
+}
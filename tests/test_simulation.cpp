@@ -0,0 +1,124 @@
+/* ============================================================================
+ * test_simulation.cpp
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Minimum unit tests for the thread pool, the scenario bank and the
+ *  multi-profile simulation driver.
+ *
+ *  Created: 	October 2026
+ *  Maintainer: Yuping X
+ * ============================================================================
+ */
+#include <gtest/gtest.h>
+#include <atomic>
+#include <vector>
+#include "personalFinSim.h"
+#include "scenarioBank.h"
+#include "threadPool.h"
+#include "testProfiles.h"
+
+TEST(ThreadPoolTest, ParallelForVisitsEveryIndexOnce) {
+    ThreadPool pool(4);
+    std::vector<std::atomic<int>> visits(1000);
+    pool.parallelFor(visits.size(), [&](size_t i) { visits[i]++; });
+    for (const std::atomic<int>& v : visits) {
+        EXPECT_EQ(v.load(), 1);
+    }
+
+    EXPECT_THROW(pool.parallelFor(10, [](size_t i) {
+        if (i == 5) throw std::runtime_error("fail");
+    }), std::runtime_error);
+}
+
+TEST(ScenarioBankTest, DeterminedBySeed) {
+    ThreadPool pool(3);
+    ScenarioBank sequential(42, 200);
+    ScenarioBank parallel(42, 200, &pool);
+    ScenarioBank other(43, 200);
+
+    ASSERT_EQ(sequential.size(), 200u);
+    bool differs = false;
+    for (size_t i = 0; i < sequential.size(); i++) {
+        EXPECT_EQ(sequential[i], parallel[i]);
+        differs = differs || (sequential[i] != other[i]);
+    }
+    EXPECT_TRUE(differs);
+}
+
+TEST(SimulationTest, ConcurrentProfilesMatchSequential) {
+    std::vector<UserData> profiles;
+    for (int p = 0; p < 6; p++) {
+        profiles.push_back(makeTestUser("user" + std::to_string(p), 40000 + 10000 * p));
+    }
+
+    ThreadPool pool(4);
+    ScenarioBank bank(7, 500, &pool);
+    std::vector<SimResult> results = simulateProfiles(profiles, bank, pool);
+
+    ASSERT_EQ(results.size(), profiles.size());
+    for (size_t p = 0; p < profiles.size(); p++) {
+        SimResult expected = simulateProfile(profiles[p], bank);
+        EXPECT_EQ(results[p].profileId, profiles[p].profileId);
+        EXPECT_EQ(results[p].seed, 7u);
+        EXPECT_EQ(results[p].longevityCounts, expected.longevityCounts);
+        EXPECT_EQ(results[p].predefinedLongevity, expected.predefinedLongevity);
+        EXPECT_EQ(results[p].constantLongevity, expected.constantLongevity);
+
+        unsigned int total = 0;
+        for (unsigned int count : results[p].longevityCounts) {
+            total += count;
+        }
+        EXPECT_EQ(total, bank.size());
+    }
+}
+
+TEST(SimulationTest, DeadlineReturnsPartialEstimate) {
+    UserData user = makeTestUser("late", 90000);
+    ScenarioBank bank(7, 2000);
+
+    /* A deadline in the past keeps only the deterministic results */
+    SimResult late = simulateProfile(user, bank, SimClock::now());
+    EXPECT_EQ(late.iterations, 0u);
+    EXPECT_TRUE(late.deadlineReached);
+
+    SimResult full = simulateProfile(user, bank);
+    SimResult generous = simulateProfile(user, bank, SimClock::now() + std::chrono::seconds(60));
+    EXPECT_EQ(full.iterations, bank.size());
+    EXPECT_EQ(generous.longevityCounts, full.longevityCounts);
+    EXPECT_EQ(late.predefinedLongevity, full.predefinedLongevity);
+    EXPECT_EQ(late.constantLongevity, full.constantLongevity);
+
+    /* The first chunk alone, as a deadline cutting the run short gives */
+    SimResult partial = late;
+    simulateScenarios(user, bank, 0, ANYTIME_FIRST_CHUNK, partial);
+
+    /* More iterations give a tighter interval around a consistent mean */
+    LongevityEstimate rough = estimateLongevity(partial);
+    LongevityEstimate precise = estimateLongevity(full);
+    EXPECT_GT(rough.halfWidth95, precise.halfWidth95);
+    EXPECT_NEAR(rough.mean, precise.mean, rough.halfWidth95 + precise.halfWidth95 + 1.0);
+}
+
+TEST(SimulationTest, PastDeadlineBoundsBatchTime) {
+    std::vector<UserData> profiles;
+    for (int p = 0; p < 2000; p++) {
+        profiles.push_back(makeTestUser("user" + std::to_string(p), 40000 + 10 * p));
+    }
+
+    ThreadPool pool(4);
+    ScenarioBank bank(7, 2000, &pool);
+
+    /* Profiles reached after the deadline run no randomized chunk, so the
+     * batch costs only the deterministic models, not 64 paths per profile */
+    SimClock::time_point start = SimClock::now();
+    std::vector<SimResult> results = simulateProfiles(profiles, bank, pool, start);
+    double seconds = std::chrono::duration<double>(SimClock::now() - start).count();
+
+    ASSERT_EQ(results.size(), profiles.size());
+    for (const SimResult& result : results) {
+        EXPECT_EQ(result.iterations, 0u);
+        EXPECT_TRUE(result.deadlineReached);
+    }
+    EXPECT_LT(seconds, 1.0);
+}
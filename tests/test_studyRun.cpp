@@ -0,0 +1,128 @@
+/* ============================================================================
+ * test_studyRun.cpp
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Minimum unit tests for long studies, their checkpoint files and the
+ *  merging of their shards.
+ *
+ *  Created: 	October 2026
+ *  Maintainer: Yuping X
+ * ============================================================================
+ */
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <fstream>
+#include <cstdio>
+#include <vector>
+#include "studyRun.h"
+#include "personalFinSim.h"
+#include "scenarioBank.h"
+#include "threadPool.h"
+#include "testProfiles.h"
+
+TEST(StudyRunTest, ResumedRunMatchesUninterruptedRun) {
+    const std::string file = "test_study_checkpoint.pfss";
+    const uint64_t seed = 11;
+    const unsigned int iterations = 3000;
+    std::vector<UserData> profiles = {makeTestUser("a", 60000), makeTestUser("b", 90000)};
+    ThreadPool pool(3);
+
+    /* Run the first third, save it, and stop as if interrupted */
+    StudyState state = initStudy(profiles, seed, iterations, 0, iterations);
+    state.endIteration = 1000;
+    runStudy(profiles, state, pool, file, 0);
+
+    /* Resume from the file */
+    StudyState resumed = readStudyState(file);
+    EXPECT_EQ(resumed.nextIteration, 1000u);
+    resumed.endIteration = iterations;
+    runStudy(profiles, resumed, pool, file, 0);
+    EXPECT_EQ(readStudyState(file).nextIteration, iterations);
+    std::remove(file.c_str());
+
+    ScenarioBank bank(seed, iterations);
+    for (size_t i = 0; i < profiles.size(); i++) {
+        SimResult expected = simulateProfile(profiles[i], bank);
+        EXPECT_EQ(resumed.results[i].profileId, expected.profileId);
+        EXPECT_EQ(resumed.results[i].iterations, iterations);
+        EXPECT_EQ(resumed.results[i].longevityCounts, expected.longevityCounts);
+        EXPECT_EQ(resumed.results[i].predefinedLongevity, expected.predefinedLongevity);
+        EXPECT_EQ(resumed.results[i].constantLongevity, expected.constantLongevity);
+    }
+}
+
+TEST(StudyRunTest, RejectsOtherProfilesAndCorruptFiles) {
+    const std::string file = "test_study_corrupt.pfss";
+    std::vector<UserData> profiles = {makeTestUser("a", 60000)};
+    StudyState state = initStudy(profiles, 5, 100, 0, 100);
+    writeStudyState(file, state);
+
+    /* Names do not matter, the numbers do */
+    std::vector<UserData> renamed = {makeTestUser("renamed", 60000)};
+    EXPECT_NO_THROW(checkStudyProfiles(readStudyState(file), renamed));
+    std::vector<UserData> changed = {makeTestUser("a", 61000)};
+    EXPECT_THROW(checkStudyProfiles(readStudyState(file), changed), std::runtime_error);
+
+    /* Flip one byte of the counts */
+    {
+        std::fstream f(file, std::ios::binary | std::ios::in | std::ios::out);
+        f.seekp(sizeof(StudyStateHeader) + 48);
+        f.put('\x7f');
+    }
+    EXPECT_THROW(readStudyState(file), std::runtime_error);
+
+    /* A profile count past the end of the file, and a file of junk */
+    writeStudyState(file, state);
+    {
+        uint32_t count = 0xffffffffu;
+        std::fstream f(file, std::ios::binary | std::ios::in | std::ios::out);
+        f.seekp(offsetof(StudyStateHeader, profileCount));
+        f.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    }
+    EXPECT_THROW(readStudyState(file), std::runtime_error);
+    std::ofstream(file) << "not a checkpoint";
+    EXPECT_THROW(readStudyState(file), std::runtime_error);
+    std::remove(file.c_str());
+}
+
+TEST(StudyRunTest, EmptyStudyRunsNothing) {
+    std::vector<UserData> none;
+    ThreadPool pool(2);
+    StudyState state = initStudy(none, 5, 100, 0, 100);
+    runStudy(none, state, pool, "", 0);
+    EXPECT_TRUE(state.results.empty());
+}
+
+TEST(StudyRunTest, MergedShardsMatchSingleRun) {
+    const uint64_t seed = 21;
+    const unsigned int iterations = 2500;
+    const uint64_t shardCount = 3;
+    std::vector<UserData> profiles = {makeTestUser("a", 60000), makeTestUser("b", 90000)};
+    ThreadPool pool(2);
+
+    /* Run the shards in reverse order to check that order does not matter */
+    std::vector<StudyState> shards;
+    for (uint64_t index = shardCount; index-- > 0;) {
+        uint64_t first, end;
+        shardRange(iterations, index, shardCount, first, end);
+        shards.push_back(initStudy(profiles, seed, iterations, first, end));
+        runStudy(profiles, shards.back(), pool, "", 0);
+    }
+    StudyState merged = mergeStudyStates(shards);
+
+    StudyState single = initStudy(profiles, seed, iterations, 0, iterations);
+    runStudy(profiles, single, pool, "", 0);
+    for (size_t i = 0; i < profiles.size(); i++) {
+        EXPECT_EQ(merged.results[i].iterations, iterations);
+        EXPECT_EQ(merged.results[i].longevityCounts, single.results[i].longevityCounts);
+        EXPECT_EQ(merged.results[i].predefinedLongevity, single.results[i].predefinedLongevity);
+    }
+
+    /* A missing or repeated shard is an error */
+    std::vector<StudyState> missing(shards.begin(), shards.end() - 1);
+    EXPECT_THROW(mergeStudyStates(missing), std::runtime_error);
+    std::vector<StudyState> repeated = shards;
+    repeated.push_back(shards[0]);
+    EXPECT_THROW(mergeStudyStates(repeated), std::runtime_error);
+}
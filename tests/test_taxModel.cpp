@@ -0,0 +1,134 @@
+/* ============================================================================
+ * test_taxModel.cpp
+ *
+ *  Description:
+ *  ---------------------------------------------------------------------------
+ *  Minimum unit tests for the federal income tax model.
+ *
+ *  Created: 	October 2026
+ *  Maintainer: Yuping X
+ * ============================================================================
+ */
+#include <gtest/gtest.h>
+#include <fstream>
+#include <cstdio>
+#include "taxModel.h"
+#include "asset.h"
+#include "profileSchedule.h"
+#include "modelRecession.h"
+#include "testProfiles.h"
+
+/* Writes the brackets of data/tax_brackets.ini */
+static void writeTestTable(const std::string& filename) {
+    std::ofstream(filename) << "# test brackets\n"
+        "Deduction = 31500\n"
+        "Ordinary-brackets = 0:0.10, 23850:0.12, 96950:0.22, 206700:0.24, 394600:0.32, 501050:0.35, 751600:0.37\n"
+        "Gains-brackets = 0:0.00, 96700:0.15, 600050:0.20\n";
+}
+
+/* A retiree whose savings are all in one account, with job income in
+ * year 0 only, no inflation, and no pension */
+static UserData makeSaverUser(int account, float rate) {
+    UserData user = makeNamedUser("saver");
+    for (int c = 0; c < MAX_ACCOUNTS; c++) {
+        user.rate[c] = rate;
+    }
+    user.value[account] = 2000000;
+    user.initialExpense = 90000;
+    user.takehomeIncome = 90000;
+    user.yearsTillRetirement = 1;
+    user.yearsTillWithdrawal = 1;
+    user.yearsTillPension = MAX_YEARS;
+    return user;
+}
+
+/* Fund longevity of a profile under the constant growth model */
+static int constantLongevity(const UserData& user, const TaxTable* tax) {
+    Asset asset;
+    ProfileSchedule schedule;
+    asset.initializeFromUserData(user);
+    schedule.initializeFromUserData(user);
+    asset.populateGrowthCurves(ModelOption::CONSTANT);
+    asset.calculateN(schedule, tax);
+    return asset.getFundLongevity();
+}
+
+TEST(TaxTableTest, TaxesIncomeByTheBrackets) {
+    const std::string TESTFILE = "test_tax_brackets.ini";
+    writeTestTable(TESTFILE);
+    TaxTable table(TESTFILE);
+    std::remove(TESTFILE.c_str());
+
+    /* Nothing is taxed up to the deduction */
+    EXPECT_EQ(table.tax(0, 0), 0.0f);
+    EXPECT_EQ(table.tax(31500, 0), 0.0f);
+
+    /* 10% of 23850 and 12% of the remaining 44650 */
+    EXPECT_NEAR(table.tax(100000, 0), 2385 + 5358, 0.5);
+
+    /* The top bracket continues the lower ones */
+    float top = table.tax(31500 + 751600, 0);
+    EXPECT_NEAR(table.tax(31500 + 851600, 0), top + 37000, 1.0);
+
+    /* Gains fill the 0% bracket from the top of the ordinary income up, and
+     * are taxed at 15% beyond it */
+    float ordinaryTax = table.tax(50000, 0);
+    EXPECT_NEAR(ordinaryTax, 1850, 0.5);
+    EXPECT_NEAR(table.tax(50000, 50000), ordinaryTax, 0.5);
+    EXPECT_NEAR(table.tax(50000, 100000), ordinaryTax + 0.15f * (118500 - 96700), 0.5);
+
+    /* What is left of the deduction comes off the gains */
+    EXPECT_EQ(table.tax(10000, 50000), 0.0f);
+    EXPECT_NEAR(table.tax(0, 200000), 0.15f * (200000 - 31500 - 96700), 0.5);
+}
+
+TEST(TaxTableTest, RejectsInvalidTables) {
+    const std::string TESTFILE = "test_bad_tax_brackets.ini";
+    std::ofstream(TESTFILE) << "Deduction = 1000\n"
+        "Ordinary-brackets = 0:0.10, 5000:0.20, 4000:0.30\n"
+        "Gains-brackets = 0:0.00\n";
+    EXPECT_THROW(TaxTable table(TESTFILE), std::runtime_error);
+
+    std::ofstream(TESTFILE) << "Deduction = 1000\n"
+        "Ordinary-brackets = 0:1.10\n"
+        "Gains-brackets = 0:0.00\n";
+    EXPECT_THROW(TaxTable table(TESTFILE), std::runtime_error);
+
+    std::ofstream(TESTFILE) << "Deduction = 1000\n"
+        "Ordinary-brackets = 0:0.10\n"
+        "Gains-brackets = 0:0.00, 10:0.10, 20:0.15, 30:0.20\n";
+    EXPECT_THROW(TaxTable table(TESTFILE), std::runtime_error);
+
+    std::ofstream(TESTFILE) << "Ordinary-brackets = 0:0.10\n"
+        "Gains-brackets = 0:0.00\n";
+    EXPECT_THROW(TaxTable table(TESTFILE), std::runtime_error);
+    std::remove(TESTFILE.c_str());
+}
+
+TEST(TaxedSimulationTest, PreTaxSavingsLastShorter) {
+    const std::string TESTFILE = "test_tax_brackets.ini";
+    writeTestTable(TESTFILE);
+    TaxTable table(TESTFILE);
+    std::remove(TESTFILE.c_str());
+
+    /* The same savings last as long in either account without tax */
+    UserData roth = makeSaverUser(ROTH_INDEX, 0.03f);
+    UserData ira = makeSaverUser(IRA_INDEX, 0.03f);
+    int untaxed = constantLongevity(roth, nullptr);
+    ASSERT_EQ(constantLongevity(ira, nullptr), untaxed);
+    ASSERT_LT(untaxed, int(MAX_YEARS));
+
+    /* Roth distributions are tax free; IRA ones are not */
+    EXPECT_EQ(constantLongevity(roth, &table), untaxed);
+    EXPECT_LT(constantLongevity(ira, &table), untaxed);
+
+    /* Sales from the individual account are only taxed on their gains */
+    UserData flat = makeSaverUser(INDIVIDUAL_INDEX, 0.0f);
+    EXPECT_EQ(constantLongevity(flat, &table), constantLongevity(flat, nullptr));
+    UserData growing = makeSaverUser(INDIVIDUAL_INDEX, 0.08f);
+    growing.value[INDIVIDUAL_INDEX] = 10000000;
+    growing.initialExpense = growing.takehomeIncome = 900000;
+    int untaxedGrowing = constantLongevity(growing, nullptr);
+    ASSERT_LT(untaxedGrowing, int(MAX_YEARS));
+    EXPECT_LT(constantLongevity(growing, &table), untaxedGrowing);
+}